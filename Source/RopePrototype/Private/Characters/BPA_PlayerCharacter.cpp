@@ -11,6 +11,7 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Components/BPC_RopeTraversalComponent.h"
+#include "Components/BPC_RopeMovementComponent.h"
 #include "CableComponent.h"
 #include "Components/SplineComponent.h"
 #include "Components/SplineMeshComponent.h"
@@ -30,7 +31,8 @@
 #pragma region Lifecycle
 
 /// Builds default components, movement tuning, and input asset references.
-ABPA_PlayerCharacter::ABPA_PlayerCharacter()
+ABPA_PlayerCharacter::ABPA_PlayerCharacter(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UBPC_RopeMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
     PrimaryActorTick.bCanEverTick = true;
 
@@ -86,8 +88,9 @@ ABPA_PlayerCharacter::ABPA_PlayerCharacter()
     RopeSegmentLength = 140.0f;
     RopeSagRatio = 0.12f;
     RopeRadius = 1.0f;
-    RopeContactPoint = FVector::ZeroVector;
-    bHasRopeContact = false;
+    ReleasePreviewMesh = nullptr;
+    ReleasePreviewMaterial = nullptr;
+    ReleasePreviewRadius = 0.4f;
 
     bUseControllerRotationYaw = false;
     bIsAiming = false;
@@ -105,6 +108,7 @@ ABPA_PlayerCharacter::ABPA_PlayerCharacter()
     NeutralPitchDegrees = GetActorRotation().Pitch;
     bWasHanging = false;
     bIgnoreFallFromRope = false;
+    bRopeVisualAsleep = false;
     bDeathSequenceActive = false;
     LastFallShakeScale = 0.0f;
     ActiveFallShake = nullptr;
@@ -243,7 +247,8 @@ void ABPA_PlayerCharacter::Tick(const float DeltaSeconds)
     UpdateCamera(DeltaSeconds);
     ApplySmoothedMovement(DeltaSeconds);
     UpdateRotationSettings();
-    UpdateRopeVisual(DeltaSeconds);
+    UpdateRopeVisual();
+    UpdateReleasePreviewVisual();
     UpdateAimIcon();
     UpdateRopeSwingInput();
     TickLevelTimer(DeltaSeconds);
@@ -523,6 +528,13 @@ void ABPA_PlayerCharacter::OnMovementModeChanged(const EMovementMode PrevMovemen
             else
                 bIgnoreFallFromRope = true;
         }
+        else if (MoveComp->MovementMode == MOVE_Custom && bRopeAttached)
+        {
+            // Catching the rope mid-fall cancels the fall instead of landing it.
+            bTrackingFall = false;
+            bIgnoreFallFromRope = true;
+            StopFallCameraFeedback();
+        }
         else if (bTrackingFall)
         {
             EndFallTrace(GetActorLocation().Z);
@@ -550,6 +562,9 @@ void ABPA_PlayerCharacter::HandleMove(const FInputActionValue& Value)
     CachedForwardInput = MoveInput.Y;
     CachedRightInput = MoveInput.X;
     RawMoveInput = MoveInput;
+
+    if (RopeComponent != nullptr)
+        RopeComponent->RecordSwingInput(MoveInput);
 }
 
 
@@ -696,6 +711,7 @@ void ABPA_PlayerCharacter::HandleClimbInput(const FInputActionValue& Value)
         return;
 
     const float ClimbValue = Value.Get<float>();
+    RopeComponent->RecordClimbInput(ClimbValue > KINDA_SMALL_NUMBER ? 1 : (ClimbValue < -KINDA_SMALL_NUMBER ? -1 : 0));
 
     if (ClimbValue > KINDA_SMALL_NUMBER)
         RopeComponent->BeginClimbUp();
@@ -750,7 +766,7 @@ void ABPA_PlayerCharacter::UpdateRotationSettings()
 
 
 /// Updates rope visual cable to follow the current anchor.
-void ABPA_PlayerCharacter::UpdateRopeVisual(const float DeltaSeconds)
+void ABPA_PlayerCharacter::UpdateRopeVisual()
 {
     if (RopeComponent == nullptr)
         return;
@@ -762,11 +778,33 @@ void ABPA_PlayerCharacter::UpdateRopeVisual(const float DeltaSeconds)
 
     if (!bRender || RopeSpline == nullptr)
     {
+        bRopeVisualAsleep = false;
         HideRopeMeshes();
         return;
     }
 
+    // A sleeping rope does not move; keep the spline built on the frame it fell asleep.
+    if (RopeComponent->IsRopeAsleep())
+    {
+        if (bRopeVisualAsleep)
+            return;
+
+        bRopeVisualAsleep = true;
+    }
+    else
+    {
+        bRopeVisualAsleep = false;
+    }
+
     const FVector SocketLocation = GetMesh() != nullptr ? GetMesh()->GetSocketLocation(RopeCableAttachSocket) : GetActorLocation();
+
+    // Render the simulated particle chain directly so visuals match the gameplay constraint.
+    if (RopeComponent->IsRopeSimulated())
+    {
+        UpdateRopeSplineFromParticles(SocketLocation, RopeComponent->GetRopeRenderPositions());
+        return;
+    }
+
     const FVector Anchor = RopeComponent->GetAnchorLocation();
     FVector RenderAnchor = Anchor;
 
@@ -776,11 +814,11 @@ void ABPA_PlayerCharacter::UpdateRopeVisual(const float DeltaSeconds)
         RenderAnchor = SocketLocation + Dir * FMath::Max(RopeComponent->GetCurrentRopeLength(), 0.0f);
     }
 
-    UpdateRopeSplineVisual(SocketLocation, RenderAnchor, DeltaSeconds);
+    UpdateRopeSplineVisual(SocketLocation, RenderAnchor);
 }
 
 /// Regenerates spline control points and meshes for rope rendering.
-void ABPA_PlayerCharacter::UpdateRopeSplineVisual(const FVector& SocketLocation, const FVector& AnchorLocation, const float DeltaSeconds)
+void ABPA_PlayerCharacter::UpdateRopeSplineVisual(const FVector& SocketLocation, const FVector& AnchorLocation)
 {
     if (RopeSpline == nullptr || RopeMesh == nullptr)
     {
@@ -798,44 +836,14 @@ void ABPA_PlayerCharacter::UpdateRopeSplineVisual(const FVector& SocketLocation,
 
     RopeSpline->ClearSplinePoints(false);
 
-    FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeSplineTrace), false, this);
-    Params.AddIgnoredActor(this);
-
-    for (USplineMeshComponent* const SplineMeshComp : RopeMeshPool)
-    {
-        if (SplineMeshComp != nullptr)
-            Params.AddIgnoredComponent(SplineMeshComp);
-    }
-
+    // Bend at the gameplay wrap pivots instead of sweeping the full rope for contacts every frame.
+    const TArray<FRopeWrapPivot>& WrapPivots = RopeComponent->GetRopeWrapPivots();
     TArray<FVector> ControlPoints;
+    ControlPoints.Reserve(WrapPivots.Num() + 2);
     ControlPoints.Add(SocketLocation);
 
-    FVector TraceStart = SocketLocation;
-    FVector TraceEnd = AnchorLocation;
-    const float SweepRadius = FMath::Max(RopeRadius * 4.0f, 8.0f);
-    FHitResult Hit;
-    int32 ContactCount = 0;
-
-    while (ContactCount < 2 && GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, ECC_Visibility, FCollisionShape::MakeSphere(SweepRadius), Params))
-    {
-        FVector Contact = Hit.ImpactPoint + Hit.ImpactNormal * SweepRadius * 0.5f;
-
-        if (bHasRopeContact)
-            Contact = FMath::VInterpTo(RopeContactPoint, Contact, DeltaSeconds, 12.0f);
-
-        RopeContactPoint = Contact;
-        bHasRopeContact = true;
-        ControlPoints.Add(Contact);
-        TraceStart = Contact + Hit.ImpactNormal * 2.0f;
-
-        if (FVector::Distance(TraceStart, TraceEnd) < 10.0f)
-            break;
-
-        ++ContactCount;
-    }
-
-    if (ContactCount == 0)
-        bHasRopeContact = false;
+    for (int32 Index = WrapPivots.Num() - 1; Index >= 0; --Index)
+        ControlPoints.Add(WrapPivots[Index].Location);
 
     ControlPoints.Add(AnchorLocation);
 
@@ -858,11 +866,59 @@ void ABPA_PlayerCharacter::UpdateRopeSplineVisual(const FVector& SocketLocation,
     }
 
     RopeSpline->UpdateSpline();
+    LayoutRopeMeshes();
+}
+
+/// Rebuilds the rope spline through simulated particles, replacing the character end with the hand socket.
+void ABPA_PlayerCharacter::UpdateRopeSplineFromParticles(const FVector& SocketLocation, const TArray<FVector>& Particles)
+{
+    if (RopeSpline == nullptr || RopeMesh == nullptr || Particles.Num() < 2)
+    {
+        HideRopeMeshes();
+        return;
+    }
+
+    RopeSpline->ClearSplinePoints(false);
+    RopeSpline->AddSplinePoint(SocketLocation, ESplineCoordinateSpace::World, false);
+
+    // Less significant ropes thin the particle points to their segment budget; particle 0 is always kept.
+    const int32 MaxVisualSegments = RopeComponent->GetSignificanceBudget().MaxVisualSegments;
+    const int32 Stride = MaxVisualSegments > 0 ? FMath::Max(FMath::DivideAndRoundUp(Particles.Num() - 1, MaxVisualSegments), 1) : 1;
+
+    for (int32 Index = Particles.Num() - 2; Index >= 0; Index = Index > 0 ? FMath::Max(Index - Stride, 0) : -1)
+    {
+        RopeSpline->AddSplinePoint(Particles[Index], ESplineCoordinateSpace::World, false);
+        RopeSpline->SetSplinePointType(RopeSpline->GetNumberOfSplinePoints() - 1, ESplinePointType::Curve, false);
+    }
+
+    // Particle 0 sits on the last wrap pivot; the wrapped rope runs straight between pivots back to the anchor.
+    const TArray<FRopeWrapPivot>& WrapPivots = RopeComponent->GetRopeWrapPivots();
+
+    if (WrapPivots.Num() > 0)
+    {
+        for (int32 Index = WrapPivots.Num() - 2; Index >= 0; --Index)
+        {
+            RopeSpline->AddSplinePoint(WrapPivots[Index].Location, ESplineCoordinateSpace::World, false);
+            RopeSpline->SetSplinePointType(RopeSpline->GetNumberOfSplinePoints() - 1, ESplinePointType::Linear, false);
+        }
+
+        RopeSpline->AddSplinePoint(RopeComponent->GetAnchorLocation(), ESplineCoordinateSpace::World, false);
+        RopeSpline->SetSplinePointType(RopeSpline->GetNumberOfSplinePoints() - 1, ESplinePointType::Linear, false);
+    }
+
+    RopeSpline->UpdateSpline();
+    LayoutRopeMeshes();
+}
 
+/// Distributes pooled spline meshes evenly along the current rope spline.
+void ABPA_PlayerCharacter::LayoutRopeMeshes()
+{
     const float SplineLength = RopeSpline->GetSplineLength();
     const float SegmentTarget = RopeSegmentLength > KINDA_SMALL_NUMBER ? RopeSegmentLength : 100.0f;
-    const int32 SegmentCount = FMath::Clamp(FMath::CeilToInt(SplineLength / SegmentTarget), 1, 64);
-    EnsureRopeMeshPool(SegmentCount);
+    const int32 MaxVisualSegments = RopeComponent != nullptr ? RopeComponent->GetSignificanceBudget().MaxVisualSegments : 0;
+    const int32 MaxSegments = MaxVisualSegments > 0 ? FMath::Min(MaxVisualSegments, 64) : 64;
+    const int32 SegmentCount = FMath::Clamp(FMath::CeilToInt(SplineLength / SegmentTarget), 1, MaxSegments);
+    EnsureSplineMeshPool(RopeMeshPool, SegmentCount);
 
     const float SegmentDistance = SplineLength / SegmentCount;
 
@@ -900,13 +956,13 @@ void ABPA_PlayerCharacter::UpdateRopeSplineVisual(const FVector& SocketLocation,
     }
 }
 
-/// Grows rope mesh pool to desired size.
-void ABPA_PlayerCharacter::EnsureRopeMeshPool(const int32 SegmentCount)
+/// Grows a spline mesh pool to desired size.
+void ABPA_PlayerCharacter::EnsureSplineMeshPool(TArray<USplineMeshComponent*>& MeshPool, const int32 SegmentCount)
 {
     if (RopeSpline == nullptr)
         return;
 
-    while (RopeMeshPool.Num() < SegmentCount)
+    while (MeshPool.Num() < SegmentCount)
     {
         USplineMeshComponent* const NewMesh = NewObject<USplineMeshComponent>(this);
 
@@ -919,22 +975,73 @@ void ABPA_PlayerCharacter::EnsureRopeMeshPool(const int32 SegmentCount)
         NewMesh->SetForwardAxis(ESplineMeshAxis::X);
         NewMesh->AttachToComponent(RopeSpline, FAttachmentTransformRules::KeepWorldTransform);
         NewMesh->RegisterComponent();
-        RopeMeshPool.Add(NewMesh);
+        MeshPool.Add(NewMesh);
+    }
+}
+
+/// Hides every spline mesh instance in a pool.
+void ABPA_PlayerCharacter::HideSplineMeshes(const TArray<USplineMeshComponent*>& MeshPool)
+{
+    for (USplineMeshComponent* const SplineMeshComp : MeshPool)
+    {
+        if (SplineMeshComp != nullptr)
+        {
+            SplineMeshComp->SetVisibility(false);
+            SplineMeshComp->SetHiddenInGame(true);
+        }
     }
 }
 
 /// Hides spline mesh instances when rope is not rendered.
 void ABPA_PlayerCharacter::HideRopeMeshes()
 {
-    for (USplineMeshComponent* const SplineMeshComp : RopeMeshPool)
+    HideSplineMeshes(RopeMeshPool);
+}
+
+/// Draws the release arc one pooled spline mesh per sampled segment.
+void ABPA_PlayerCharacter::UpdateReleasePreviewVisual()
+{
+    if (RopeComponent == nullptr || ReleasePreviewMesh == nullptr || !RopeComponent->IsHanging() || RopeComponent->GetReleasePreviewPoints().Num() < 2)
     {
-        if (SplineMeshComp != nullptr)
+        HideSplineMeshes(ReleasePreviewMeshPool);
+        return;
+    }
+
+    const TArray<FVector>& Points = RopeComponent->GetReleasePreviewPoints();
+    const int32 SegmentCount = Points.Num() - 1;
+    EnsureSplineMeshPool(ReleasePreviewMeshPool, SegmentCount);
+
+    for (int32 Index = 0; Index < ReleasePreviewMeshPool.Num(); ++Index)
+    {
+        USplineMeshComponent* const SplineMeshComp = ReleasePreviewMeshPool[Index];
+
+        if (SplineMeshComp == nullptr)
+            continue;
+
+        if (Index >= SegmentCount)
         {
             SplineMeshComp->SetVisibility(false);
             SplineMeshComp->SetHiddenInGame(true);
+            continue;
         }
+
+        // Central differences through the samples keep the segments on the parabola; the ends fall back to one-sided.
+        const int32 Previous = FMath::Max(Index - 1, 0);
+        const int32 Next = FMath::Min(Index + 2, Points.Num() - 1);
+        const FVector StartTangent = (Points[Index + 1] - Points[Previous]) / static_cast<float>(Index + 1 - Previous);
+        const FVector EndTangent = (Points[Next] - Points[Index]) / static_cast<float>(Next - Index);
+
+        SplineMeshComp->SetStaticMesh(ReleasePreviewMesh);
+
+        if (ReleasePreviewMaterial != nullptr)
+            SplineMeshComp->SetMaterial(0, ReleasePreviewMaterial);
+
+        SplineMeshComp->SetStartAndEnd(Points[Index], StartTangent, Points[Index + 1], EndTangent);
+        SplineMeshComp->SetStartScale(FVector2D(ReleasePreviewRadius, ReleasePreviewRadius));
+        SplineMeshComp->SetEndScale(FVector2D(ReleasePreviewRadius, ReleasePreviewRadius));
+        SplineMeshComp->SetVisibility(true);
+        SplineMeshComp->SetHiddenInGame(false);
     }
-    bHasRopeContact = false;
 }
 
 
@@ -953,7 +1060,14 @@ void ABPA_PlayerCharacter::UpdateAimIcon()
     AimIconWidget->SetVisibility(ESlateVisibility::HitTestInvisible);
     const bool bHasPreview = RopeComponent != nullptr && RopeComponent->HasValidPreview();
     const bool bWithinRange = bHasPreview && RopeComponent->IsPreviewWithinRange();
-    const FLinearColor IconColor = bHasPreview && bWithinRange ? FLinearColor(0.8f, 1.0f, 0.8f, 0.8f) : FLinearColor(1.0f, 0.25f, 0.25f, 0.8f);
+    const bool bArcBlocked = bWithinRange && RopeComponent->IsPreviewArcBlocked();
+
+    // Amber tells a reachable target apart from one the throw arc cannot get to.
+    FLinearColor IconColor = bHasPreview && bWithinRange ? FLinearColor(0.8f, 1.0f, 0.8f, 0.8f) : FLinearColor(1.0f, 0.25f, 0.25f, 0.8f);
+
+    if (bArcBlocked)
+        IconColor = FLinearColor(1.0f, 0.65f, 0.15f, 0.8f);
+
     AimIconWidget->SetColorAndOpacity(IconColor);
 }
 #pragma endregion Camera
@@ -1133,11 +1247,14 @@ void ABPA_PlayerCharacter::PlayLevelExitFade()
 }
 
 
-/// Forwards cached movement to rope swing input when hanging.
+/// Forwards cached movement to rope swing input when hanging; the rope movement mode reads it back from acceleration.
 void ABPA_PlayerCharacter::UpdateRopeSwingInput()
 {
-    if (RopeComponent != nullptr && RopeComponent->IsHanging())
-        RopeComponent->ApplySwingInput(FVector2D(CachedRightInput, CachedForwardInput));
+    if (RopeComponent == nullptr || !RopeComponent->IsHanging())
+        return;
+
+    AddMovementInput(GetActorForwardVector(), CachedForwardInput);
+    AddMovementInput(GetActorRightVector(), CachedRightInput);
 }
 
 
@@ -0,0 +1,516 @@
+// Summary: Implements the offline anchor and ledge bake over World Partition cells.
+#include "Commandlets/RopeAnchorBakeCommandlet.h"
+
+#include "RopePrototype.h"
+#include "Misc/Parse.h"
+
+#if WITH_EDITOR
+#include "Characters/BPA_PlayerCharacter.h"
+#include "Components/BPC_RopeTraversalComponent.h"
+#include "Engine/LevelBounds.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "FileHelpers.h"
+#include "Misc/PackageName.h"
+#include "Simulation/RopeSimCore.h"
+#include "UObject/Package.h"
+#include "World/BPA_RopeAnchorCell.h"
+#include "World/RopeAnchorCellData.h"
+#include "WorldPartition/LoaderAdapter/LoaderAdapterShape.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionEditorLoaderAdapter.h"
+
+namespace RopeAnchorBake
+{
+    // Summary: Default column spacing of the surface scan in cm; also the length of one edge sample.
+    constexpr float DefaultSpacing = 50.0f;
+
+    // Summary: Default bake cell edge in cm; matches the default World Partition runtime grid.
+    constexpr float DefaultCellSize = 12800.0f;
+
+    // Summary: Default aim assist radius of baked anchors in cm.
+    constexpr float DefaultAnchorRadius = 25.0f;
+
+    // Summary: Default content folder the cell assets are written under.
+    const TCHAR* const DefaultOutputRoot = TEXT("/Game/RopeBake");
+
+    // Summary: Extra geometry loaded around a cell so edge probes near its border see their neighbours in cm.
+    constexpr float LoadMargin = 400.0f;
+
+    // Summary: Minimum normal Z of a scanned surface that can carry a ledge.
+    constexpr float WalkableNormalZ = 0.55f;
+
+    // Summary: Highest face normal Z still treated as a wall an anchor sits on.
+    constexpr float MaxFaceNormalZ = 0.5f;
+
+    // Summary: Drop below a surface edge required before it counts as a ledge in cm.
+    constexpr float MinLedgeDrop = 100.0f;
+
+    // Summary: Height above a surface the edge probes run at in cm.
+    constexpr float EdgeProbeLift = 20.0f;
+
+    // Summary: Depth below the edge the face trace runs at in cm.
+    constexpr float FaceProbeDepth = 20.0f;
+
+    // Summary: Stacked surfaces scanned per column, for bridges and floors above floors.
+    constexpr int32 MaxLayersPerColumn = 4;
+
+    // Summary: Distance the column scan skips below a surface before looking for the next one in cm.
+    constexpr float LayerStep = 50.0f;
+
+    // Summary: Longest baked span in cm; keeps each span in few registry cells.
+    constexpr float MaxSpanLength = 800.0f;
+
+    // Summary: Minimum dot between face normals merged into one span.
+    constexpr float SpanNormalDot = 0.98f;
+
+    // Summary: Planar directions probed for edges from every surface sample.
+    const FIntPoint EdgeDirections[] = { FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1) };
+
+    // Summary: Ledge rules copied from the rope component so baked data matches runtime climbs.
+    struct FLedgeRules
+    {
+        float ProbeRadius = 0.0f;
+        float NormalDotThreshold = 0.0f;
+        float StandOffDistance = 0.0f;
+    };
+
+    // Summary: Anchor found at one column edge before spans are merged.
+    struct FEdgeSample
+    {
+        FVector Anchor = FVector::ZeroVector;
+        FVector Normal = FVector::UpVector;
+        FVector LedgeOffset = FVector::ZeroVector;
+        bool bHasLedge = false;
+        bool bConsumed = false;
+    };
+
+    // Summary: Reads the ledge rules from the traversal component of a character class default object.
+    bool ReadLedgeRules(const UClass* const CharacterClass, FLedgeRules& OutRules)
+    {
+        const AActor* const CharacterDefaults = CharacterClass != nullptr ? Cast<AActor>(CharacterClass->GetDefaultObject()) : nullptr;
+        const UBPC_RopeTraversalComponent* const Rope = CharacterDefaults != nullptr ? CharacterDefaults->FindComponentByClass<UBPC_RopeTraversalComponent>() : nullptr;
+
+        if (Rope == nullptr)
+        {
+            return false;
+        }
+
+        Rope->GetLedgeRules(OutRules.ProbeRadius, OutRules.NormalDotThreshold, OutRules.StandOffDistance);
+        return true;
+    }
+
+    // Summary: Tests one surface sample for an edge along a planar direction and fills the anchor and ledge found there.
+    bool ProbeEdge(const UWorld& World, const FVector& Surface, const FVector& Direction, const float Spacing, const FLedgeRules& Rules, const FCollisionQueryParams& Params, FEdgeSample& OutSample)
+    {
+        const FVector Lift = FVector::UpVector * EdgeProbeLift;
+        const FVector Beyond = Surface + Direction * Spacing;
+        FHitResult Hit;
+
+        // A wall right beside the surface is not an edge.
+        if (World.LineTraceSingleByChannel(Hit, Surface + Lift, Beyond + Lift, ECC_Visibility, Params))
+        {
+            return false;
+        }
+
+        // Ground within the minimum drop means the surface simply continues or steps down.
+        if (World.LineTraceSingleByChannel(Hit, Beyond + Lift, Beyond - FVector::UpVector * MinLedgeDrop, ECC_Visibility, Params))
+        {
+            return false;
+        }
+
+        // Trace back under the lip to find the face the rope would hit.
+        const FVector FaceDepth = FVector::UpVector * FaceProbeDepth;
+
+        if (!World.LineTraceSingleByChannel(Hit, Beyond - FaceDepth, Surface - FaceDepth, ECC_Visibility, Params) || FMath::Abs(Hit.ImpactNormal.Z) > MaxFaceNormalZ)
+        {
+            return false;
+        }
+
+        OutSample.Anchor = FVector(Hit.ImpactPoint.X, Hit.ImpactPoint.Y, Surface.Z);
+        OutSample.Normal = Hit.ImpactNormal;
+
+        // Same probe and acceptance as the runtime climb, so the cached stand location is the one a live sweep would find.
+        FVector ProbeStart = FVector::ZeroVector;
+        FVector ProbeEnd = FVector::ZeroVector;
+        FRopeSimCore::GetLedgeProbe(OutSample.Anchor, OutSample.Normal, Rules.ProbeRadius, ProbeStart, ProbeEnd);
+
+        if (World.SweepSingleByChannel(Hit, ProbeStart, ProbeEnd, FQuat::Identity, ECC_Visibility, FCollisionShape::MakeSphere(Rules.ProbeRadius), Params)
+            && FRopeSimCore::IsValidLedgeNormal(Hit.ImpactNormal, OutSample.Normal, Rules.NormalDotThreshold))
+        {
+            const FVector StandLocation = FRopeSimCore::GetLedgeStandLocation(Hit.ImpactPoint, OutSample.Normal, -Direction, Rules.StandOffDistance);
+            OutSample.LedgeOffset = StandLocation - OutSample.Anchor;
+            OutSample.bHasLedge = true;
+        }
+
+        return true;
+    }
+
+    // Summary: Scans the columns of one cell and collects edge samples keyed by column and direction.
+    void ScanCell(const UWorld& World, const FBox& CellBox, const float Spacing, const FLedgeRules& Rules, TMap<FIntVector, TArray<FEdgeSample>>& OutSamples)
+    {
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeAnchorBake), false);
+        const int32 ColumnsX = FMath::CeilToInt32(CellBox.GetSize().X / Spacing);
+        const int32 ColumnsY = FMath::CeilToInt32(CellBox.GetSize().Y / Spacing);
+
+        for (int32 IndexY = 0; IndexY < ColumnsY; ++IndexY)
+        {
+            for (int32 IndexX = 0; IndexX < ColumnsX; ++IndexX)
+            {
+                const float X = CellBox.Min.X + (IndexX + 0.5f) * Spacing;
+                const float Y = CellBox.Min.Y + (IndexY + 0.5f) * Spacing;
+                float Top = CellBox.Max.Z;
+
+                for (int32 Layer = 0; Layer < MaxLayersPerColumn && Top > CellBox.Min.Z; ++Layer)
+                {
+                    FHitResult SurfaceHit;
+
+                    if (!World.LineTraceSingleByChannel(SurfaceHit, FVector(X, Y, Top), FVector(X, Y, CellBox.Min.Z), ECC_Visibility, Params))
+                    {
+                        break;
+                    }
+
+                    Top = SurfaceHit.ImpactPoint.Z - LayerStep;
+
+                    if (SurfaceHit.bStartPenetrating || SurfaceHit.ImpactNormal.Z < WalkableNormalZ)
+                    {
+                        continue;
+                    }
+
+                    for (int32 DirectionIndex = 0; DirectionIndex < UE_ARRAY_COUNT(EdgeDirections); ++DirectionIndex)
+                    {
+                        const FVector Direction(EdgeDirections[DirectionIndex].X, EdgeDirections[DirectionIndex].Y, 0.0f);
+                        FEdgeSample Sample;
+
+                        if (ProbeEdge(World, SurfaceHit.ImpactPoint, Direction, Spacing, Rules, Params, Sample))
+                        {
+                            OutSamples.FindOrAdd(FIntVector(IndexX, IndexY, DirectionIndex)).Add(Sample);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Summary: Returns an unconsumed sample in a column that continues a span, or null.
+    FEdgeSample* FindSpanNeighbour(TMap<FIntVector, TArray<FEdgeSample>>& Samples, const FIntVector& Key, const FEdgeSample& From, const float Spacing)
+    {
+        TArray<FEdgeSample>* const Column = Samples.Find(Key);
+
+        if (Column == nullptr)
+        {
+            return nullptr;
+        }
+
+        for (FEdgeSample& Sample : *Column)
+        {
+            if (!Sample.bConsumed
+                && Sample.bHasLedge == From.bHasLedge
+                && FMath::Abs(Sample.Anchor.Z - From.Anchor.Z) <= Spacing * 0.5f
+                && FVector::DotProduct(Sample.Normal, From.Normal) >= SpanNormalDot)
+            {
+                return &Sample;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Summary: Merges neighbouring edge samples along each edge into straight spans.
+    void MergeSpans(TMap<FIntVector, TArray<FEdgeSample>>& Samples, const float Spacing, TArray<FRopeBakedAnchor>& OutAnchors)
+    {
+        const int32 MaxSpanSamples = FMath::Max(FMath::FloorToInt32(MaxSpanLength / Spacing), 1);
+
+        for (TPair<FIntVector, TArray<FEdgeSample>>& Pair : Samples)
+        {
+            // Edges facing along X run along Y and the other way round.
+            const FIntVector Step = Pair.Key.Z < 2 ? FIntVector(0, 1, 0) : FIntVector(1, 0, 0);
+
+            for (FEdgeSample& Seed : Pair.Value)
+            {
+                if (Seed.bConsumed)
+                {
+                    continue;
+                }
+
+                Seed.bConsumed = true;
+                const FEdgeSample* First = &Seed;
+                const FEdgeSample* Last = &Seed;
+                FVector LedgeOffsetSum = Seed.LedgeOffset;
+                FVector NormalSum = Seed.Normal;
+                int32 Count = 1;
+
+                // Grow both ways; the seed may sit anywhere along the edge.
+                for (int32 Sign = -1; Sign <= 1; Sign += 2)
+                {
+                    FIntVector Key = Pair.Key;
+                    const FEdgeSample* Tail = &Seed;
+
+                    while (Count < MaxSpanSamples)
+                    {
+                        Key += Step * Sign;
+                        FEdgeSample* const Next = FindSpanNeighbour(Samples, Key, *Tail, Spacing);
+
+                        if (Next == nullptr)
+                        {
+                            break;
+                        }
+
+                        Next->bConsumed = true;
+                        LedgeOffsetSum += Next->LedgeOffset;
+                        NormalSum += Next->Normal;
+                        ++Count;
+                        Tail = Next;
+                    }
+
+                    if (Sign < 0)
+                    {
+                        First = Tail;
+                    }
+                    else
+                    {
+                        Last = Tail;
+                    }
+                }
+
+                // Samples are column centers; the span covers half a column past each end sample.
+                const FVector Along = (Last->Anchor - First->Anchor).GetSafeNormal();
+                const FVector Extend = (Along.IsNearlyZero() ? FVector::ZeroVector : Along) * (Spacing * 0.5f);
+
+                FRopeBakedAnchor& Anchor = OutAnchors.AddDefaulted_GetRef();
+                Anchor.Start = FVector3f(First->Anchor - Extend);
+                Anchor.End = FVector3f(Last->Anchor + Extend);
+                Anchor.Normal = FVector3f(NormalSum.GetSafeNormal());
+                Anchor.LedgeOffset = FVector3f(LedgeOffsetSum / Count);
+                Anchor.bHasLedge = Seed.bHasLedge;
+            }
+        }
+    }
+
+    // Summary: Finds the cell actor a previous bake placed for a cell label.
+    ABPA_RopeAnchorCell* FindCellActor(UWorld& World, const FString& Label)
+    {
+        for (TActorIterator<ABPA_RopeAnchorCell> It(&World); It; ++It)
+        {
+            if (It->GetActorLabel() == Label)
+            {
+                return *It;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Summary: Bakes one cell and saves its data asset and cell actor; returns the number of anchors written.
+    int32 BakeCell(UWorld& World, const FString& MapShortName, const FString& OutputRoot, const FIntPoint& Cell, const FBox& CellBox, const float Spacing, const float AnchorRadius, const FLedgeRules& Rules)
+    {
+        TMap<FIntVector, TArray<FEdgeSample>> Samples;
+        ScanCell(World, CellBox, Spacing, Rules, Samples);
+
+        TArray<FRopeBakedAnchor> Anchors;
+        MergeSpans(Samples, Spacing, Anchors);
+
+        const FString CellName = FString::Printf(TEXT("%s_%d_%d"), *MapShortName, Cell.X, Cell.Y);
+        const FString Label = FString::Printf(TEXT("RopeAnchorCell_%s"), *CellName);
+        ABPA_RopeAnchorCell* CellActor = FindCellActor(World, Label);
+        TArray<UPackage*> PackagesToSave;
+
+        if (Anchors.Num() == 0)
+        {
+            // Clear a stale bake so the cell no longer streams anchors that are gone.
+            if (CellActor != nullptr && CellActor->GetCellData() != nullptr)
+            {
+                CellActor->Modify();
+                CellActor->SetCellData(nullptr);
+                UEditorLoadingAndSavingUtils::SavePackages({ CellActor->GetPackage() }, false);
+            }
+
+            return 0;
+        }
+
+        const FString AssetName = FString::Printf(TEXT("RAC_%s"), *CellName);
+        const FString PackageName = FString::Printf(TEXT("%s/%s/%s"), *OutputRoot, *MapShortName, *AssetName);
+        UPackage* const Package = CreatePackage(*PackageName);
+        URopeAnchorCellData* CellData = LoadObject<URopeAnchorCellData>(Package, *AssetName, nullptr, LOAD_NoWarn | LOAD_Quiet);
+
+        if (CellData == nullptr)
+        {
+            CellData = NewObject<URopeAnchorCellData>(Package, *AssetName, RF_Public | RF_Standalone);
+        }
+
+        CellData->Modify();
+        CellData->CellBounds = CellBox;
+        CellData->AnchorRadius = AnchorRadius;
+        CellData->LedgeStandOffDistance = Rules.StandOffDistance;
+        CellData->LedgeNormalDotThreshold = Rules.NormalDotThreshold;
+        CellData->Anchors = MoveTemp(Anchors);
+        PackagesToSave.Add(Package);
+
+        // The actor sits at the cell center so World Partition streams it, and the data it references, with the cell.
+        if (CellActor == nullptr)
+        {
+            CellActor = World.SpawnActor<ABPA_RopeAnchorCell>(CellBox.GetCenter(), FRotator::ZeroRotator);
+            CellActor->SetActorLabel(Label);
+        }
+
+        CellActor->Modify();
+        CellActor->SetCellData(CellData);
+        PackagesToSave.Add(CellActor->GetPackage());
+
+        UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, false);
+        return CellData->Anchors.Num();
+    }
+
+    // Summary: Loads a map, bakes every cell overlapping its bounds, and tears the world down again.
+    bool BakeMap(const FString& MapName, const FString& OutputRoot, const float CellSize, const float Spacing, const float AnchorRadius, const FLedgeRules& Rules)
+    {
+        UPackage* const MapPackage = LoadPackage(nullptr, *MapName, LOAD_None);
+        UWorld* const World = MapPackage != nullptr ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+
+        if (World == nullptr)
+        {
+            UE_LOG(LogRopePrototype, Error, TEXT("Rope anchor bake: could not load map %s."), *MapName);
+            return false;
+        }
+
+        World->AddToRoot();
+        World->WorldType = EWorldType::Editor;
+
+        if (!World->bIsWorldInitialized)
+        {
+            World->InitWorld(UWorld::InitializationValues()
+                .CreatePhysicsScene(true)
+                .EnableTraceCollision(true)
+                .ShouldSimulatePhysics(false)
+                .CreateNavigation(false)
+                .CreateAISystem(false)
+                .AllowAudioPlayback(false));
+        }
+
+        World->UpdateWorldComponents(true, true);
+
+        UWorldPartition* const WorldPartition = World->GetWorldPartition();
+        const FBox WorldBounds = WorldPartition != nullptr ? WorldPartition->GetEditorWorldBounds() : ALevelBounds::CalculateLevelBounds(World->PersistentLevel);
+        const FString MapShortName = FPackageName::GetShortName(MapName);
+
+        if (!WorldBounds.IsValid)
+        {
+            UE_LOG(LogRopePrototype, Warning, TEXT("Rope anchor bake: %s has no geometry."), *MapName);
+        }
+        else
+        {
+            const FIntPoint MinCell(FMath::FloorToInt32(WorldBounds.Min.X / CellSize), FMath::FloorToInt32(WorldBounds.Min.Y / CellSize));
+            const FIntPoint MaxCell(FMath::FloorToInt32(WorldBounds.Max.X / CellSize), FMath::FloorToInt32(WorldBounds.Max.Y / CellSize));
+            int32 TotalAnchors = 0;
+
+            for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+            {
+                for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+                {
+                    const FBox CellBox(
+                        FVector(CellX * CellSize, CellY * CellSize, WorldBounds.Min.Z),
+                        FVector((CellX + 1) * CellSize, (CellY + 1) * CellSize, WorldBounds.Max.Z));
+
+                    // Only one cell and its margin are loaded at a time, so large partitioned maps bake in bounded memory.
+                    UWorldPartitionEditorLoaderAdapter* const Loader = WorldPartition != nullptr
+                        ? WorldPartition->CreateEditorLoaderAdapter<FLoaderAdapterShape>(World, CellBox.ExpandBy(LoadMargin), TEXT("RopeAnchorBake"))
+                        : nullptr;
+
+                    if (Loader != nullptr)
+                    {
+                        Loader->GetLoaderAdapter()->Load();
+                    }
+
+                    const int32 CellAnchors = BakeCell(*World, MapShortName, OutputRoot, FIntPoint(CellX, CellY), CellBox, Spacing, AnchorRadius, Rules);
+                    TotalAnchors += CellAnchors;
+
+                    if (Loader != nullptr)
+                    {
+                        WorldPartition->ReleaseEditorLoaderAdapter(Loader);
+                        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+                    }
+
+                    if (CellAnchors > 0)
+                    {
+                        UE_LOG(LogRopePrototype, Display, TEXT("Rope anchor bake: %s cell (%d, %d) -> %d anchors."), *MapShortName, CellX, CellY, CellAnchors);
+                    }
+                }
+            }
+
+            UE_LOG(LogRopePrototype, Display, TEXT("Rope anchor bake: %s finished with %d anchors."), *MapShortName, TotalAnchors);
+        }
+
+        World->DestroyWorld(false);
+        World->RemoveFromRoot();
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        return true;
+    }
+}
+#endif
+
+#pragma region Methods
+URopeAnchorBakeCommandlet::URopeAnchorBakeCommandlet()
+{
+    // Maps are loaded, traced, and saved as editor worlds.
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 URopeAnchorBakeCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+    FString MapList;
+    FParse::Value(*Params, TEXT("map="), MapList, false);
+
+    TArray<FString> MapNames;
+    MapList.ParseIntoArray(MapNames, TEXT(","));
+
+    if (MapNames.Num() == 0)
+    {
+        UE_LOG(LogRopePrototype, Error, TEXT("Rope anchor bake: pass -map=/Game/Levels/LV_Name[,...]."));
+        return 1;
+    }
+
+    FString CharacterPath;
+    FParse::Value(*Params, TEXT("character="), CharacterPath);
+    const UClass* const CharacterClass = CharacterPath.IsEmpty() ? ABPA_PlayerCharacter::StaticClass() : LoadClass<AActor>(nullptr, *CharacterPath);
+
+    RopeAnchorBake::FLedgeRules Rules;
+
+    if (!RopeAnchorBake::ReadLedgeRules(CharacterClass, Rules))
+    {
+        UE_LOG(LogRopePrototype, Error, TEXT("Rope anchor bake: %s has no rope traversal component to read ledge rules from."), *CharacterPath);
+        return 1;
+    }
+
+    float Spacing = RopeAnchorBake::DefaultSpacing;
+    float CellSize = RopeAnchorBake::DefaultCellSize;
+    float AnchorRadius = RopeAnchorBake::DefaultAnchorRadius;
+    FString OutputRoot = RopeAnchorBake::DefaultOutputRoot;
+    FParse::Value(*Params, TEXT("spacing="), Spacing);
+    FParse::Value(*Params, TEXT("cellsize="), CellSize);
+    FParse::Value(*Params, TEXT("anchorradius="), AnchorRadius);
+    FParse::Value(*Params, TEXT("output="), OutputRoot);
+
+    Spacing = FMath::Max(Spacing, 10.0f);
+    CellSize = FMath::Max(CellSize, Spacing);
+
+    int32 Failures = 0;
+
+    for (const FString& MapName : MapNames)
+    {
+        if (!RopeAnchorBake::BakeMap(MapName.TrimStartAndEnd(), OutputRoot, CellSize, Spacing, AnchorRadius, Rules))
+        {
+            ++Failures;
+        }
+    }
+
+    return Failures > 0 ? 1 : 0;
+#else
+    UE_LOG(LogRopePrototype, Error, TEXT("Rope anchor bake needs an editor build."));
+    return 1;
+#endif
+}
+#pragma endregion Methods
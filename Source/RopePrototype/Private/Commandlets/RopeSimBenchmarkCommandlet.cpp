@@ -0,0 +1,36 @@
+// Summary: Implements the headless rope simulation benchmark commandlet.
+#include "Commandlets/RopeSimBenchmarkCommandlet.h"
+
+#include "RopePrototype.h"
+#include "Misc/Parse.h"
+#include "Simulation/RopeSimBenchmarks.h"
+
+#pragma region Methods
+URopeSimBenchmarkCommandlet::URopeSimBenchmarkCommandlet()
+{
+    // Benchmarks need no editor, client, or server world; the scene query scenario creates its own.
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 URopeSimBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 Steps = 0;
+    FParse::Value(*Params, TEXT("steps="), Steps);
+
+    TArray<FRopeBenchmarkResult> Results;
+    RopeSimBenchmarks::RunAll(Steps, Results);
+
+    for (const int32 ParticleCount : {16, 32, 64})
+    {
+        RopeSimBenchmarks::RunCollisionSceneQueries(ParticleCount, Steps > 0 ? Steps : RopeSimBenchmarks::DefaultSteps, Results);
+    }
+
+    RopeSimBenchmarks::LogResults(Results);
+
+    UE_LOG(LogRopePrototype, Display, TEXT("Rope benchmarks finished: %d scenarios."), Results.Num());
+    return 0;
+}
+#pragma endregion Methods
@@ -0,0 +1,76 @@
+// Summary: Implements grapple anchor registration and the anchor span in world space.
+#include "Components/BPC_RopeAnchorPointComponent.h"
+
+#include "Engine/World.h"
+#include "Subsystems/RopeAnchorRegistrySubsystem.h"
+
+#pragma region Methods
+#pragma region Lifecycle
+UBPC_RopeAnchorPointComponent::UBPC_RopeAnchorPointComponent()
+{
+    // Anchors are queried, never ticked.
+    PrimaryComponentTick.bCanEverTick = false;
+
+    AnchorHalfLength = 0.0f;
+    AnchorRadius = 20.0f;
+    RegistryHandle = INDEX_NONE;
+}
+
+void UBPC_RopeAnchorPointComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UWorld* const World = GetWorld())
+    {
+        if (URopeAnchorRegistrySubsystem* const Subsystem = World->GetSubsystem<URopeAnchorRegistrySubsystem>())
+        {
+            Registry = Subsystem;
+            RegistryHandle = Subsystem->RegisterAnchor(*this);
+        }
+    }
+}
+
+void UBPC_RopeAnchorPointComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (URopeAnchorRegistrySubsystem* const Subsystem = Registry.Get())
+    {
+        Subsystem->UnregisterAnchor(RegistryHandle);
+    }
+
+    Registry.Reset();
+    RegistryHandle = INDEX_NONE;
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UBPC_RopeAnchorPointComponent::OnUpdateTransform(const EUpdateTransformFlags UpdateTransformFlags, const ETeleportType Teleport)
+{
+    Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+    if (URopeAnchorRegistrySubsystem* const Subsystem = Registry.Get())
+    {
+        Subsystem->UpdateAnchor(RegistryHandle);
+    }
+}
+#pragma endregion Lifecycle
+
+#pragma region Query
+void UBPC_RopeAnchorPointComponent::GetAnchorSegment(FVector& OutStart, FVector& OutEnd) const
+{
+    const FVector Center = GetComponentLocation();
+    const FVector HalfSpan = GetForwardVector() * (AnchorHalfLength * GetComponentScale().X);
+    OutStart = Center - HalfSpan;
+    OutEnd = Center + HalfSpan;
+}
+
+FVector UBPC_RopeAnchorPointComponent::GetAnchorNormal() const
+{
+    return GetUpVector();
+}
+
+float UBPC_RopeAnchorPointComponent::GetAnchorRadius() const
+{
+    return AnchorRadius;
+}
+#pragma endregion Query
+#pragma endregion Methods
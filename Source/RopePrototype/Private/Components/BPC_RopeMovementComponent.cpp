@@ -0,0 +1,396 @@
+// Summary: Implements rope swing and tether movement inside the character movement update.
+#include "Components/BPC_RopeMovementComponent.h"
+
+#include "RopePrototype.h"
+#include "Components/BPC_RopeTraversalComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Character.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Phys Swing"), STAT_RopePhysSwing, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Phys Tether"), STAT_RopePhysTether, STATGROUP_Rope);
+
+#pragma region Saved Moves
+// Summary: Saved move carrying rope climb input so replays and server moves climb identically, plus the rope length
+// and wrap pivot count the move started from so a replay climbs from where the original move did.
+class FSavedMove_RopeCharacter : public FSavedMove_Character
+{
+public:
+    typedef FSavedMove_Character Super;
+
+    virtual void Clear() override
+    {
+        Super::Clear();
+        SavedClimbInput = 0;
+        SavedRopeLength = 0.0f;
+        SavedWrapPivotCount = INDEX_NONE;
+    }
+
+    virtual uint8 GetCompressedFlags() const override
+    {
+        uint8 Flags = Super::GetCompressedFlags();
+
+        if (SavedClimbInput > 0)
+        {
+            Flags |= FLAG_Custom_0;
+        }
+        else if (SavedClimbInput < 0)
+        {
+            Flags |= FLAG_Custom_1;
+        }
+
+        return Flags;
+    }
+
+    virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override
+    {
+        if (SavedClimbInput != static_cast<const FSavedMove_RopeCharacter*>(NewMove.Get())->SavedClimbInput)
+        {
+            return false;
+        }
+
+        return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+    }
+
+    virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override
+    {
+        Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+        if (const UBPC_RopeMovementComponent* const MoveComp = Cast<UBPC_RopeMovementComponent>(C->GetCharacterMovement()))
+        {
+            SavedClimbInput = static_cast<int8>(MoveComp->GetRopeClimbInput());
+        }
+
+        if (const UBPC_RopeTraversalComponent* const Rope = C->FindComponentByClass<UBPC_RopeTraversalComponent>())
+        {
+            SavedRopeLength = Rope->GetCurrentRopeLength();
+            SavedWrapPivotCount = Rope->GetRopeWrapPivots().Num();
+        }
+    }
+
+    virtual void CombineWith(const FSavedMove_Character* OldMove, ACharacter* C, APlayerController* PC, const FVector& OldStartLocation) override
+    {
+        Super::CombineWith(OldMove, C, PC, OldStartLocation);
+
+        // The combined move restarts from the old move's start, so the rope does too.
+        const FSavedMove_RopeCharacter* const OldRopeMove = static_cast<const FSavedMove_RopeCharacter*>(OldMove);
+        SavedRopeLength = OldRopeMove->SavedRopeLength;
+        SavedWrapPivotCount = OldRopeMove->SavedWrapPivotCount;
+        RestoreRope(C);
+    }
+
+    virtual void PrepMoveFor(ACharacter* C) override
+    {
+        Super::PrepMoveFor(C);
+
+        if (UBPC_RopeMovementComponent* const MoveComp = Cast<UBPC_RopeMovementComponent>(C->GetCharacterMovement()))
+        {
+            MoveComp->SetRopeClimbInput(SavedClimbInput);
+        }
+
+        RestoreRope(C);
+    }
+
+    // Summary: Puts the rope back to the state this move started from.
+    void RestoreRope(ACharacter* C) const
+    {
+        if (UBPC_RopeTraversalComponent* const Rope = C->FindComponentByClass<UBPC_RopeTraversalComponent>())
+        {
+            Rope->RestoreRopeForReplay(SavedRopeLength, SavedWrapPivotCount);
+        }
+    }
+
+    // Summary: Climb direction recorded for this move.
+    int8 SavedClimbInput = 0;
+
+    // Summary: Rope length when this move started; zero when no rope was attached.
+    float SavedRopeLength = 0.0f;
+
+    // Summary: Wrap pivot count when this move started.
+    int32 SavedWrapPivotCount = INDEX_NONE;
+};
+
+// Summary: Client prediction data allocating rope-aware saved moves.
+class FNetworkPredictionData_Client_RopeCharacter : public FNetworkPredictionData_Client_Character
+{
+public:
+    typedef FNetworkPredictionData_Client_Character Super;
+
+    explicit FNetworkPredictionData_Client_RopeCharacter(const UCharacterMovementComponent& ClientMovement)
+        : Super(ClientMovement)
+    {
+    }
+
+    virtual FSavedMovePtr AllocateNewMove() override
+    {
+        return FSavedMovePtr(new FSavedMove_RopeCharacter());
+    }
+};
+#pragma endregion Saved Moves
+
+#pragma region Methods
+#pragma region Lifecycle
+UBPC_RopeMovementComponent::UBPC_RopeMovementComponent()
+{
+    RopeFloorProbeDistance = 150.0f;
+    RopeClimbInput = 0;
+    RopeReplayAccumulator = 0.0f;
+}
+
+void UBPC_RopeMovementComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    RopeComponent = GetOwner() != nullptr ? GetOwner()->FindComponentByClass<UBPC_RopeTraversalComponent>() : nullptr;
+}
+
+FNetworkPredictionData_Client* UBPC_RopeMovementComponent::GetPredictionData_Client() const
+{
+    if (ClientPredictionData == nullptr)
+    {
+        UBPC_RopeMovementComponent* const MutableThis = const_cast<UBPC_RopeMovementComponent*>(this);
+        MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_RopeCharacter(*this);
+    }
+
+    return ClientPredictionData;
+}
+#pragma endregion Lifecycle
+
+#pragma region Input
+void UBPC_RopeMovementComponent::SetRopeClimbInput(const int32 ClimbSign)
+{
+    RopeClimbInput = FMath::Clamp(ClimbSign, -1, 1);
+}
+
+int32 UBPC_RopeMovementComponent::GetRopeClimbInput() const
+{
+    return RopeClimbInput;
+}
+
+bool UBPC_RopeMovementComponent::IsRopeSwinging() const
+{
+    return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(ERopeMovementMode::RopeSwing);
+}
+
+void UBPC_RopeMovementComponent::UpdateFromCompressedFlags(const uint8 Flags)
+{
+    Super::UpdateFromCompressedFlags(Flags);
+
+    const bool bClimbUp = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+    const bool bClimbDown = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+    RopeClimbInput = bClimbUp ? 1 : (bClimbDown ? -1 : 0);
+}
+
+FVector2D UBPC_RopeMovementComponent::GetRopeSwingInput() const
+{
+    const float MaxAccel = GetMaxAcceleration();
+
+    if (CharacterOwner == nullptr || MaxAccel <= KINDA_SMALL_NUMBER)
+    {
+        return FVector2D::ZeroVector;
+    }
+
+    // Acceleration is the replicated input path, so swing input replays with saved moves.
+    const FVector InputAxis = Acceleration / MaxAccel;
+    return FVector2D(FVector::DotProduct(InputAxis, CharacterOwner->GetActorRightVector()), FVector::DotProduct(InputAxis, CharacterOwner->GetActorForwardVector()));
+}
+#pragma endregion Input
+
+#pragma region Physics
+void UBPC_RopeMovementComponent::PhysCustom(const float DeltaTime, const int32 Iterations)
+{
+    if (CustomMovementMode == static_cast<uint8>(ERopeMovementMode::RopeSwing))
+    {
+        PhysRopeSwing(DeltaTime, Iterations);
+        return;
+    }
+
+    Super::PhysCustom(DeltaTime, Iterations);
+}
+
+void UBPC_RopeMovementComponent::PhysWalking(const float DeltaTime, const int32 Iterations)
+{
+    Super::PhysWalking(DeltaTime, Iterations);
+
+    // Landing or falling off a ledge hands off to another mode that applies its own tether.
+    if (MovementMode == MOVE_Walking)
+    {
+        ApplyRopeTether(DeltaTime);
+    }
+}
+
+void UBPC_RopeMovementComponent::PhysFalling(const float DeltaTime, const int32 Iterations)
+{
+    Super::PhysFalling(DeltaTime, Iterations);
+
+    if (MovementMode == MOVE_Falling)
+    {
+        ApplyRopeTether(DeltaTime);
+    }
+}
+
+void UBPC_RopeMovementComponent::PhysRopeSwing(const float DeltaTime, int32 Iterations)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopePhysSwing);
+
+    if (DeltaTime < MIN_TICK_TIME)
+    {
+        return;
+    }
+
+    UBPC_RopeTraversalComponent* const Rope = RopeComponent.Get();
+
+    if (Rope == nullptr || CharacterOwner == nullptr)
+    {
+        SetMovementMode(MOVE_Falling);
+        StartNewPhysics(DeltaTime, Iterations);
+        return;
+    }
+
+    // Physics-thread ropes hold the capsule here; the rope component applies their results.
+    if (!Rope->IsMovementDriven())
+    {
+        return;
+    }
+
+    // Windowed input only exists where nothing replays or re-simulates the move; everywhere else swing comes from the
+    // replicated acceleration and climb from the saved-move flags.
+    const bool bSubframeInput = !CharacterOwner->bClientUpdating;
+    const int32 StepCount = BeginRopeSteps(*Rope, DeltaTime);
+    const float StepSeconds = Rope->GetSimulationStepSeconds();
+    float RemainingTime = DeltaTime;
+
+    // Whole fixed steps only; the remainder stays in the rope's clock and blends the rendered rope.
+    for (int32 Step = 0; Step < StepCount && IsRopeSwinging(); ++Step)
+    {
+        FVector2D SwingInput = GetRopeSwingInput();
+        FRopeInputWindow InputWindow;
+
+        if (bSubframeInput && Rope->ConsumeRopeInput(StepSeconds, InputWindow))
+        {
+            SwingInput = InputWindow.SwingInput;
+        }
+
+        const FRopeSimState* const State = Rope->AdvanceRopeMovement(ERopeSimStepKind::Hanging, StepSeconds, SwingInput, RopeClimbInput, InputWindow.ClimbTapSign);
+
+        if (State == nullptr)
+        {
+            break;
+        }
+
+        ++Iterations;
+        RemainingTime = FMath::Max(RemainingTime - StepSeconds, 0.0f);
+
+        // One swept move onto the solved end particle replaces falling physics plus a late correction.
+        const FVector TargetLocation = State->Location;
+        Velocity = State->Velocity;
+        FHitResult MoveHit(1.0f);
+        MoveToRopeLocation(TargetLocation, StepSeconds, MoveHit);
+
+        UpdateRopeFloor(*Rope, MoveHit);
+        Rope->FinishRopeMovementStep(ERopeSimStepKind::Hanging);
+    }
+
+    Rope->EndRopeMovementFrame();
+
+    // Hanging ended mid-update; spend the rest of the frame in the new mode.
+    if (!IsRopeSwinging() && RemainingTime >= MIN_TICK_TIME)
+    {
+        StartNewPhysics(RemainingTime, Iterations);
+    }
+}
+
+void UBPC_RopeMovementComponent::ApplyRopeTether(const float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopePhysTether);
+
+    UBPC_RopeTraversalComponent* const Rope = RopeComponent.Get();
+
+    if (Rope == nullptr || !Rope->IsTetherActive())
+    {
+        return;
+    }
+
+    const int32 StepCount = BeginRopeSteps(*Rope, DeltaTime);
+    const float StepSeconds = Rope->GetSimulationStepSeconds();
+
+    for (int32 Step = 0; Step < StepCount && Rope->IsTetherActive(); ++Step)
+    {
+        const FRopeSimState* const State = Rope->AdvanceRopeMovement(ERopeSimStepKind::Tether, StepSeconds, FVector2D::ZeroVector, RopeClimbInput, 0);
+
+        if (State == nullptr)
+        {
+            break;
+        }
+
+        if (State->bBeyondLength)
+        {
+            const FVector TargetLocation = State->Location;
+            Velocity = State->Velocity;
+            FHitResult MoveHit(1.0f);
+            MoveToRopeLocation(TargetLocation, StepSeconds, MoveHit);
+        }
+
+        Rope->FinishRopeMovementStep(ERopeSimStepKind::Tether);
+    }
+
+    Rope->EndRopeMovementFrame();
+}
+
+int32 UBPC_RopeMovementComponent::BeginRopeSteps(UBPC_RopeTraversalComponent& Rope, const float DeltaTime)
+{
+    // Corrections replay saved moves on a clock of their own so the live remainder survives the replay.
+    if (CharacterOwner != nullptr && CharacterOwner->bClientUpdating)
+    {
+        return Rope.ConsumeSimulationSteps(DeltaTime, RopeReplayAccumulator);
+    }
+
+    RopeReplayAccumulator = 0.0f;
+    return Rope.BeginRopeMovementFrame(DeltaTime);
+}
+
+void UBPC_RopeMovementComponent::MoveToRopeLocation(const FVector& TargetLocation, const float DeltaTime, FHitResult& OutHit)
+{
+    const FVector Delta = TargetLocation - UpdatedComponent->GetComponentLocation();
+
+    if (Delta.IsNearlyZero())
+    {
+        return;
+    }
+
+    SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, OutHit);
+
+    if (OutHit.Time < 1.0f)
+    {
+        HandleImpact(OutHit, DeltaTime, Delta);
+
+        FHitResult SlideHit = OutHit;
+        SlideAlongSurface(Delta, 1.0f - OutHit.Time, OutHit.Normal, SlideHit, true);
+
+        // Sliding off a wall onto the ground reports the ground as the contact.
+        if (!IsWalkable(OutHit) && IsWalkable(SlideHit))
+        {
+            OutHit = SlideHit;
+        }
+    }
+}
+
+void UBPC_RopeMovementComponent::UpdateRopeFloor(const UBPC_RopeTraversalComponent& Rope, const FHitResult& MoveHit)
+{
+    const float ProbeDistance = FMath::Max(RopeFloorProbeDistance, 0.0f);
+
+    // Height above the lowest point of the current arc; near zero the rope hangs almost straight down.
+    const FVector ToCharacter = UpdatedComponent->GetComponentLocation() - Rope.GetSwingPivot();
+    const float HeightAboveArcBottom = ToCharacter.Size() + ToCharacter.Z;
+
+    // Like falling, the move's own sweep is the floor contact; only probe when it found ground or ground may sit just below.
+    if (!IsWalkable(MoveHit) && HeightAboveArcBottom > ProbeDistance)
+    {
+        CurrentFloor.Clear();
+        return;
+    }
+
+    const UCapsuleComponent* const Capsule = CharacterOwner->GetCapsuleComponent();
+    ComputeFloorDist(UpdatedComponent->GetComponentLocation(), ProbeDistance, ProbeDistance, CurrentFloor, Capsule->GetScaledCapsuleRadius());
+}
+#pragma endregion Physics
+#pragma endregion Methods
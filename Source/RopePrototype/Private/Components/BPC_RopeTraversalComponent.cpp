@@ -1,19 +1,80 @@
 // Summary: Implements rope traversal logic including aiming, throwing, hanging, swinging, climbing, and recall.
 #include "Components/BPC_RopeTraversalComponent.h"
 
+#include "RopePrototype.h"
+#include "Subsystems/RopeSimulationSubsystem.h"
+#include "Components/BPC_RopeMovementComponent.h"
+#include "Simulation/RopeAsyncPhysics.h"
+#include "Simulation/RopeCollisionField.h"
+#include "World/BPA_LooseRope.h"
 #include "Camera/PlayerCameraManager.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/PrimitiveComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "DrawDebugHelpers.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Apply Hanging"), STAT_RopeApplyHanging, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Apply Tether"), STAT_RopeApplyTether, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Particle Collision"), STAT_RopeParticleCollision, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Wrap Update"), STAT_RopeWrapUpdate, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Sleep Update"), STAT_RopeSleepUpdate, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Release Preview"), STAT_RopeReleasePreview, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Release Preview Sweeps"), STAT_RopeReleasePreviewSweeps, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Aim Traces Issued"), STAT_RopeAimTracesIssued, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Aim Traces Skipped"), STAT_RopeAimTracesSkipped, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Flight Sweep"), STAT_RopeFlightSweep, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rope Flight Sweeps"), STAT_RopeFlightSweeps, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Aim Arc Validation"), STAT_RopeAimArcValidation, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Aim Arc Sweeps"), STAT_RopeAimArcSweeps, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rope Field Queries"), STAT_RopeFieldQueries, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rope Particle Scene Queries"), STAT_RopeParticleSceneQueries, STATGROUP_Rope);
+
+namespace RopeWrap
+{
+    // Summary: Closest a new pivot may sit to the swing pivot or the character in cm.
+    constexpr float MinPivotSpacing = 10.0f;
+
+    // Summary: Free rope kept between the last pivot and the character in cm.
+    constexpr float MinFreeLength = 20.0f;
+
+    // Summary: Bisection passes toward last frame's clear end when locating a corner.
+    constexpr int32 CornerRefineIterations = 4;
+}
+
+namespace RopeCollision
+{
+    // Summary: Field region grows this much past the current rope length so climbing down does not force a rebuild.
+    constexpr float RegionSlack = 1.25f;
+
+    // Summary: Field band width in cells; particles moving farther than half of it in one step sweep instead.
+    constexpr float BandCells = 4.0f;
+
+    // Summary: Margin around the rope bounds searched for movable bodies in cm.
+    constexpr float DynamicMargin = 50.0f;
+}
+
+namespace RopeReleasePreview
+{
+    // Summary: Upper bound on cached arc segments regardless of horizon and sample spacing.
+    constexpr int32 MaxSegments = 128;
+}
+
+namespace RopeAimAssist
+{
+    // Summary: Distance the confirm trace runs past the candidate so it still reaches the anchor's surface in cm.
+    constexpr float ConfirmOvershoot = 10.0f;
+}
 
 #pragma region Methods
 #pragma region Lifecycle
 UBPC_RopeTraversalComponent::UBPC_RopeTraversalComponent()
 {
-    // Configure ticking to run after physics for rope constraints.
-    PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.TickGroup = TG_PostPhysics;
+    // Rope logic is batch-ticked by URopeSimulationSubsystem; the component never ticks itself.
+    PrimaryComponentTick.bCanEverTick = false;
     PrimaryComponentTick.bStartWithTickEnabled = false;
 
     // Initialize serialized defaults for rope behavior tuning (scaled for ~1m ledges).
@@ -22,6 +83,8 @@ UBPC_RopeTraversalComponent::UBPC_RopeTraversalComponent()
     ClimbMinLength = 0.0f;
     AnchorAssistDistance = 120.0f;
     ThrowSpeed = 2400.0f;
+    RopeFlightSweepSegments = 24;
+    RopeFlightSweepRadius = 4.0f;
     RecallHoldSeconds = 1.0f;
     RecallRetractSpeed = 2600.0f;
     SwingAcceleration = 600.0f;
@@ -35,27 +98,108 @@ UBPC_RopeTraversalComponent::UBPC_RopeTraversalComponent()
     LedgeVerticalOffset = 0.0f;
     LedgeClimbCooldownSeconds = 0.35f;
     GroundClimbProximity = 120.0f;
+    RopeParticleCount = 16;
+    RopeSolverIterations = 8;
+    RopeCharacterInverseMass = 0.05f;
+    RopeCollisionRadius = 4.0f;
+    bUseRopeCollisionField = true;
+    RopeCollisionVoxelSize = 10.0f;
+    SimulationStepRate = 120.0f;
+    MaxSimulationSubsteps = 4;
+    SwingIntegrator = ERopeSwingIntegrator::Explicit;
+    bSimulateOnPhysicsThread = false;
+    bUseSubframeInput = true;
+    RopeStretchMode = ERopeStretchMode::Rigid;
+    ElasticStiffness = 60.0f;
+    ElasticDamping = 2.0f;
+    bEnableRopeWrapping = true;
+    RopeWrapOffset = 4.0f;
+    MaxRopeWrapPivots = 8;
+    bAllowRopeSleep = true;
+    SleepSpeedThreshold = 5.0f;
+    SleepLengthThreshold = 0.5f;
+    SleepFramesRequired = 30;
+    SleepWakeDistance = 2.0f;
+    SignificanceBudgets[static_cast<int32>(ERopeSignificance::Full)] = FRopeSignificanceBudget(1500.0f, 1.0f, 0, true, false);
+    SignificanceBudgets[static_cast<int32>(ERopeSignificance::Reduced)] = FRopeSignificanceBudget(4000.0f, 0.5f, 16, true, false);
+    SignificanceBudgets[static_cast<int32>(ERopeSignificance::Minimal)] = FRopeSignificanceBudget(8000.0f, 0.25f, 6, false, false);
+    SignificanceBudgets[static_cast<int32>(ERopeSignificance::Kinematic)] = FRopeSignificanceBudget(0.0f, 0.25f, 4, false, true);
+    OffscreenSignificance = ERopeSignificance::Minimal;
+    bShowReleasePreview = true;
+    ReleasePreviewSeconds = 2.0f;
+    ReleasePreviewSampleSeconds = 0.08f;
+    ReleasePreviewTolerance = 20.0f;
+    ReleasePreviewMaxSweepsPerFrame = 8;
+    ReleasePreviewBudgetMs = 0.05f;
+    AimTraceLocationEpsilon = 0.5f;
+    AimTraceRotationEpsilon = 0.05f;
+    bUseAimAssist = true;
+    AimAssistHalfAngle = 6.0f;
+    AimAssistDistanceWeight = 0.25f;
+    AimArcMaxSweepsPerFrame = 4;
+    AimArcCellSize = 25.0f;
+    AnchorReactionScale = 1.0f;
+    LooseRopeClass = ABPA_LooseRope::StaticClass();
     bDebugRopeAssist = false;
 
     // Seed runtime state for rope status and timers.
-    CurrentRopeLength = MaxRopeLength;
+    UnregisteredSimState.RopeLength = MaxRopeLength;
     bRopeAttached = false;
     bHoldingRope = false;
     bHanging = false;
     RopeState = ERopeState::Idle;
     RecallAccumulated = 0.0f;
-    ClimbInputSign = 0;
+    UnregisteredSimState.ClimbInputSign = 0;
     SavedGravityScale = 1.0f;
     bHasPreview = false;
     bPreviewWithinRange = false;
     PreviewImpactPoint = FVector::ZeroVector;
     PreviewImpactNormal = FVector::ZeroVector;
+    PreviewImpactBoneName = NAME_None;
+    LastAimTraceLocation = FVector::ZeroVector;
+    LastAimTraceRotation = FRotator::ZeroRotator;
+    bHasAimTraceView = false;
+    AimTracesIssued = 0;
+    AimTracesSkipped = 0;
+    bAimTraceIsAssist = false;
+    bAimAssistRejected = false;
+    AimArcBlockedSegment = INDEX_NONE;
+    AimArcStartCell = FIntVector::ZeroValue;
+    AimArcTargetCell = FIntVector::ZeroValue;
+    AnchorBoneName = NAME_None;
+    AnchorRelativeLocation = FVector::ZeroVector;
+    AnchorRelativeNormal = FVector::ZeroVector;
+    PendingAnchorImpulse = 0.0f;
     RopeFlightElapsed = 0.0f;
     RopeFlightDuration = 0.0f;
     RopeFlightStart = FVector::ZeroVector;
     RopeFlightTarget = FVector::ZeroVector;
+    RopeFlightSweptSegments = 0;
+    bRopeFlightBlocked = false;
+    RopeFlightBlockAlpha = 1.0f;
     bAimPreviewWhileAttached = false;
     LastLedgeClimbTime = -1000.0f;
+    SimulationAccumulator = 0.0f;
+    bSimulatedThisFrame = false;
+    StepActorLocation = FVector::ZeroVector;
+    SimulationSlot = INDEX_NONE;
+    AsyncGeneration = 0;
+    RopeWrappedLength = 0.0f;
+    LastWrapEndLocation = FVector::ZeroVector;
+    bLastWrapSegmentClear = true;
+    bRopeCollisionFieldFailed = false;
+    FailedFieldAnchor = FVector::ZeroVector;
+    FailedFieldReach = 0.0f;
+    FailedFieldVoxelSize = 0.0f;
+    RopeSignificance = ERopeSignificance::Full;
+    bRopeAsleep = false;
+    RopeQuietFrames = 0;
+    SleepCheckRopeLength = 0.0f;
+    SleepLocation = FVector::ZeroVector;
+    SleepMovementMode = MOVE_None;
+    SleepCustomMovementMode = 0;
+    bRopeInputDropped = false;
+    ReleasePreviewBlockedSegment = INDEX_NONE;
 }
 
 void UBPC_RopeTraversalComponent::BeginPlay()
@@ -64,57 +208,484 @@ void UBPC_RopeTraversalComponent::BeginPlay()
 
     // Cache owning character for movement and controller access.
     OwningCharacter = Cast<ACharacter>(GetOwner());
-    SetComponentTickEnabled(false);
+
+    // Move simulation state into the world's packed rope arrays.
+    if (UWorld* const World = GetWorld())
+    {
+        if (URopeSimulationSubsystem* const Subsystem = World->GetSubsystem<URopeSimulationSubsystem>())
+        {
+            SimulationSubsystem = Subsystem;
+            SimulationSlot = Subsystem->RegisterRope(*this);
+            Subsystem->GetState(SimulationSlot) = MoveTemp(UnregisteredSimState);
+        }
+    }
+}
+
+void UBPC_RopeTraversalComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Pull state back out so queries after end play still see the last rope.
+    if (URopeSimulationSubsystem* const Subsystem = SimulationSubsystem.Get())
+    {
+        if (Subsystem->IsValidSlot(SimulationSlot))
+        {
+            UnregisteredSimState = MoveTemp(Subsystem->GetState(SimulationSlot));
+            Subsystem->UnregisterRope(SimulationSlot);
+        }
+    }
+
+    SimulationSubsystem.Reset();
+    SimulationSlot = INDEX_NONE;
+
+    Super::EndPlay(EndPlayReason);
 }
 #pragma endregion Lifecycle
 
-#pragma region Tick
-void UBPC_RopeTraversalComponent::TickComponent(const float DeltaTime, const ELevelTick TickType, FActorComponentTickFunction* const ThisTickFunction)
+#pragma region Simulation Batch
+int32 UBPC_RopeTraversalComponent::BeginRopeFrame(const float DeltaTime)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    bSimulatedThisFrame = false;
 
     // Live update aiming preview while RMB held.
     if (RopeState == ERopeState::Aiming)
     {
         UpdateAimPreview();
-        return;
+        return 0;
     }
 
     if (RopeState == ERopeState::Airborne)
     {
         TickRopeFlight(DeltaTime);
-        return;
+        return 0;
+    }
+
+    // One transform lookup per frame keeps the anchor on a moving component for every step and query that follows.
+    if (bRopeAttached)
+    {
+        UpdateMovingAnchor();
     }
 
     // Process recall hold timer while player is pulling rope back.
     if (RopeState == ERopeState::Recalling)
     {
         RecallAccumulated += DeltaTime;
-        CurrentRopeLength = FMath::Max(CurrentRopeLength - RecallRetractSpeed * DeltaTime, 0.0f);
+        GetSimState().RopeLength = FMath::Max(GetSimState().RopeLength - RecallRetractSpeed * DeltaTime, 0.0f);
 
         // Clear rope if recall timer completes.
-        if (RecallAccumulated >= RecallHoldSeconds || CurrentRopeLength <= KINDA_SMALL_NUMBER)
+        if (RecallAccumulated >= RecallHoldSeconds || GetSimState().RopeLength <= KINDA_SMALL_NUMBER)
         {
             ClearRope();
         }
 
+        return 0;
+    }
+
+    // Hanging swing, climb, and ground tether run in fixed steps batched across all ropes.
+    if (RopeState != ERopeState::Hanging && !(RopeState == ERopeState::Attached && bHoldingRope))
+    {
+        return 0;
+    }
+
+    // Runs ahead of the sleep and kinematic early-outs; an unchanged arc costs no sweeps.
+    if (RopeState == ERopeState::Hanging)
+    {
+        UpdateReleasePreview();
+    }
+
+    // Kinematic ropes follow the replicated character; nothing is simulated or traced.
+    if (IsRopeKinematic())
+    {
+        return 0;
+    }
+
+    // Idle ropes sleep: no wrap trace, no steps, and no visual rebuild until something disturbs them.
+    if (UpdateRopeSleep())
+    {
+        return 0;
+    }
+
+    // Wrap once per frame for every integration path so all of them swing from the same pivot.
+    UpdateRopeWrap();
+    UpdateRopeCollisionField();
+
+    // The rope movement component or the physics thread advances the rope instead of the fixed-step batch.
+    if (IsMovementDriven() || bSimulateOnPhysicsThread)
+    {
+        return 0;
+    }
+
+    const int32 StepCount = ConsumeSimulationSteps(DeltaTime, SimulationAccumulator);
+    bSimulatedThisFrame = true;
+    BeginRopeInputFrame(StepCount * GetSimulationStepSeconds());
+    return StepCount;
+}
+
+bool UBPC_RopeTraversalComponent::PrepareRopeStep(FRopeSimParams& OutParams, FRopeSimInput& OutInput, ERopeSimStepKind& OutKind)
+{
+    // Abort and clear rope if owner or movement is gone.
+    if (!OwningCharacter.IsValid() || OwningCharacter->GetCharacterMovement() == nullptr)
+    {
+        ClearRope();
+        return false;
+    }
+
+    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+
+    if (RopeState == ERopeState::Hanging)
+    {
+        if (!CanContinueHanging(*MoveComp))
+        {
+            return false;
+        }
+
+        OutKind = ERopeSimStepKind::Hanging;
+    }
+    else if (RopeState == ERopeState::Attached && bHoldingRope)
+    {
+        OutKind = ERopeSimStepKind::Tether;
+    }
+    else
+    {
+        return false;
+    }
+
+    GetSimState().Particles.GetWorldPositions(PreviousStepPositions);
+    StepActorLocation = OwningCharacter->GetActorLocation();
+    OutParams = MakeSimParams();
+    OutInput = MakeSimInput(GetSimulationStepSeconds(), *MoveComp);
+
+    FRopeInputWindow InputWindow;
+
+    if (ConsumeRopeInput(GetSimulationStepSeconds(), InputWindow))
+    {
+        OutInput.SwingInput = InputWindow.SwingInput;
+        OutInput.ClimbTapSign = InputWindow.ClimbTapSign;
+    }
+
+    return true;
+}
+
+void UBPC_RopeTraversalComponent::ApplyRopeStep(const ERopeSimStepKind Kind)
+{
+    if (!OwningCharacter.IsValid())
+    {
+        ClearRope();
+        return;
+    }
+
+    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+
+    if (MoveComp == nullptr)
+    {
+        ClearRope();
+        return;
+    }
+
+    if (Kind == ERopeSimStepKind::Hanging)
+    {
+        ApplyHangingStep(*MoveComp);
+    }
+    else if (Kind == ERopeSimStepKind::Tether)
+    {
+        ApplyTetherStep(*MoveComp);
+    }
+
+    // Physics-thread results cover a whole frame and are accumulated where they arrive.
+    if (!bSimulateOnPhysicsThread)
+    {
+        AccumulateAnchorReaction(GetSimulationStepSeconds());
+    }
+}
+
+void UBPC_RopeTraversalComponent::EndRopeFrame()
+{
+    DrainRopeInput();
+
+    if (!bSimulatedThisFrame)
+    {
+        return;
+    }
+
+    // Swing input is consumed by every step of this frame, then cleared.
+    bSimulatedThisFrame = false;
+    PendingSwingInput = FVector2D::ZeroVector;
+    UpdateRopeRenderPositions(SimulationAccumulator / GetSimulationStepSeconds());
+}
+
+void UBPC_RopeTraversalComponent::SetSimulationSlot(const int32 Slot)
+{
+    SimulationSlot = Slot;
+}
+#pragma endregion Simulation Batch
+
+#pragma region Movement Integration
+int32 UBPC_RopeTraversalComponent::BeginRopeMovementFrame(const float DeltaTime)
+{
+    const int32 StepCount = ConsumeSimulationSteps(DeltaTime, SimulationAccumulator);
+    BeginRopeInputFrame(StepCount * GetSimulationStepSeconds());
+    return StepCount;
+}
+
+void UBPC_RopeTraversalComponent::EndRopeMovementFrame()
+{
+    UpdateRopeRenderPositions(SimulationAccumulator / GetSimulationStepSeconds());
+}
+
+const FRopeSimState* UBPC_RopeTraversalComponent::AdvanceRopeMovement(const ERopeSimStepKind Kind, const float DeltaTime, const FVector2D& SwingInput, const int32 ClimbSign, const int32 ClimbTapSign)
+{
+    if (!OwningCharacter.IsValid() || OwningCharacter->GetCharacterMovement() == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (!IsMovementDriven())
+    {
+        return nullptr;
+    }
+
+    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+
+    // A sleeping rope holds the capsule still; input wakes it here so the first input frame already moves.
+    if (bRopeAsleep)
+    {
+        if (SwingInput.IsNearlyZero() && ClimbSign == 0 && ClimbTapSign == 0 && MoveComp->GetCurrentAcceleration().IsNearlyZero())
+        {
+            return nullptr;
+        }
+
+        WakeRope();
+    }
+
+    if (Kind == ERopeSimStepKind::Hanging)
+    {
+        if (RopeState != ERopeState::Hanging || !CanContinueHanging(*MoveComp))
+        {
+            return nullptr;
+        }
+    }
+    else if (Kind != ERopeSimStepKind::Tether || !IsTetherActive())
+    {
+        return nullptr;
+    }
+
+    FRopeSimInput Input = MakeSimInput(DeltaTime, *MoveComp);
+    Input.SwingInput = SwingInput;
+    Input.ClimbTapSign = ClimbTapSign;
+    GetSimState().ClimbInputSign = ClimbSign;
+
+    // Movement steps are fixed length too, so EndRopeMovementFrame blends from the pose before the latest one.
+    GetSimState().Particles.GetWorldPositions(PreviousStepPositions);
+    FRopeSimCore::Step(Kind, MakeSimParams(), Input, GetSimState());
+    ResolveRopeParticleCollisions();
+    AccumulateAnchorReaction(DeltaTime);
+    return &GetSimState();
+}
+
+void UBPC_RopeTraversalComponent::FinishRopeMovementStep(const ERopeSimStepKind Kind)
+{
+    if (!OwningCharacter.IsValid() || OwningCharacter->GetCharacterMovement() == nullptr)
+    {
+        return;
+    }
+
+    if (Kind == ERopeSimStepKind::Hanging)
+    {
+        FinishHangingStep(*OwningCharacter->GetCharacterMovement());
+    }
+    else if (Kind == ERopeSimStepKind::Tether)
+    {
+        FinishTetherStep(*OwningCharacter->GetCharacterMovement());
+    }
+}
+
+void UBPC_RopeTraversalComponent::RestoreRopeForReplay(const float RopeLength, const int32 WrapPivotCount)
+{
+    if (!bRopeAttached || RopeLength <= 0.0f)
+    {
         return;
     }
 
-    // Simulate hanging swing and climb only while in hanging state.
+    GetSimState().RopeLength = FMath::Clamp(RopeLength, GetClimbMinLength(), MaxRopeLength);
+
+    // Pivots added after the move started are dropped and the chain rebuilt; pivots unwound since then cannot be
+    // recreated and re-wrap on the next wrap update.
+    if (WrapPivotCount >= 0 && WrapPivotCount < RopeWrapPivots.Num())
+    {
+        RopeWrapPivots.SetNum(WrapPivotCount, EAllowShrinking::No);
+        RebuildRopeAfterWrap();
+    }
+}
+
+bool UBPC_RopeTraversalComponent::IsTetherActive() const
+{
+    return RopeState == ERopeState::Attached && bHoldingRope && !bHanging;
+}
+#pragma endregion Movement Integration
+
+#pragma region Physics Thread
+bool UBPC_RopeTraversalComponent::IsSimulatedOnPhysicsThread() const
+{
+    return bSimulateOnPhysicsThread && !bRopeAsleep && !IsRopeKinematic() && (RopeState == ERopeState::Hanging || IsTetherActive());
+}
+
+bool UBPC_RopeTraversalComponent::PrepareAsyncRopeInput(FRopeAsyncRopeInput& OutInput)
+{
+    if (!OwningCharacter.IsValid() || OwningCharacter->GetCharacterMovement() == nullptr)
+    {
+        ClearRope();
+        return false;
+    }
+
+    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+
     if (RopeState == ERopeState::Hanging)
     {
-        TickHanging(DeltaTime);
+        if (!CanContinueHanging(*MoveComp))
+        {
+            return false;
+        }
+
+        OutInput.Kind = ERopeSimStepKind::Hanging;
+    }
+    else if (IsTetherActive())
+    {
+        OutInput.Kind = ERopeSimStepKind::Tether;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Physics reuses this snapshot for every step until the next frame pushes a new one.
+    OutInput.Generation = AsyncGeneration;
+    OutInput.Params = MakeSimParams();
+    OutInput.Input = MakeSimInput(0.0f, *MoveComp);
+    OutInput.ClimbInputSign = GetSimState().ClimbInputSign;
+    OutInput.RopeLength = GetSimState().RopeLength;
+
+    if (const UBPC_RopeMovementComponent* const RopeMovement = GetRopeMovement())
+    {
+        OutInput.Input.SwingInput = RopeMovement->GetRopeSwingInput();
+    }
+
+    // Physics steps reuse one snapshot per frame, so the whole frame is a single input window.
+    const float FrameSeconds = GetWorld() != nullptr ? GetWorld()->GetDeltaSeconds() : 0.0f;
+    FRopeInputWindow InputWindow;
+    BeginRopeInputFrame(FrameSeconds);
+
+    if (ConsumeRopeInput(FrameSeconds, InputWindow))
+    {
+        OutInput.Input.SwingInput = InputWindow.SwingInput;
+        OutInput.Input.ClimbTapSign = InputWindow.ClimbTapSign;
+    }
+
+    PendingSwingInput = FVector2D::ZeroVector;
+    return true;
+}
+
+void UBPC_RopeTraversalComponent::ApplyAsyncRopeOutput(const FRopeAsyncRopeOutput& Output)
+{
+    // Results solved before the last reset or for a mode the rope already left are stale.
+    const bool bKindActive = Output.Kind == ERopeSimStepKind::Hanging ? RopeState == ERopeState::Hanging : IsTetherActive();
+
+    if (Output.Generation != AsyncGeneration || !bKindActive || !OwningCharacter.IsValid())
+    {
         return;
     }
 
-    // Maintain ground tether when holding rope on foot.
-    if (RopeState == ERopeState::Attached && bHoldingRope)
+    FRopeSimState& State = GetSimState();
+    State.RopeLength = Output.RopeLength;
+    State.Location = Output.Location;
+    State.Velocity = Output.Velocity;
+    State.bTensioned = Output.bTensioned;
+    State.bBeyondLength = Output.bBeyondLength;
+    State.Tension = Output.Tension;
+    State.ConstraintImpulse = Output.ConstraintImpulse;
+
+    // Reaching full extension while climbing down stops the climb, matching the game-thread path.
+    if (State.ClimbInputSign < 0 && Output.ClimbInputSign == 0)
+    {
+        SetClimbInputSign(0);
+    }
+
+    if (State.Particles.Num() != Output.Positions.Num())
+    {
+        State.Particles.Initialize(GetSwingPivot(), OwningCharacter->GetActorLocation(), Output.Positions.Num(), GetFreeRopeLength(), RopeCharacterInverseMass);
+    }
+
+    State.Particles.SetLocalPositions(Output.Origin, Output.Positions);
+    State.Particles.SetSegmentTensions(Output.SegmentTensions);
+    AccumulateAnchorReaction(GetWorld() != nullptr ? GetWorld()->GetDeltaSeconds() : 0.0f);
+    StepActorLocation = OwningCharacter->GetActorLocation();
+    ApplyRopeStep(Output.Kind);
+
+    // Results arrive once per frame at most, so render the latest particles directly.
+    PreviousStepPositions.Reset();
+    UpdateRopeRenderPositions(1.0f);
+}
+#pragma endregion Physics Thread
+
+#pragma region Simulation State
+
+FRopeSimState& UBPC_RopeTraversalComponent::GetSimState()
+{
+    URopeSimulationSubsystem* const Subsystem = SimulationSubsystem.Get();
+    return Subsystem != nullptr && Subsystem->IsValidSlot(SimulationSlot) ? Subsystem->GetState(SimulationSlot) : UnregisteredSimState;
+}
+
+const FRopeSimState& UBPC_RopeTraversalComponent::GetSimState() const
+{
+    const URopeSimulationSubsystem* const Subsystem = SimulationSubsystem.Get();
+    return Subsystem != nullptr && Subsystem->IsValidSlot(SimulationSlot) ? Subsystem->GetState(SimulationSlot) : UnregisteredSimState;
+}
+
+float UBPC_RopeTraversalComponent::GetRopeForceScale() const
+{
+    const UCharacterMovementComponent* const MoveComp = OwningCharacter.IsValid() ? OwningCharacter->GetCharacterMovement() : nullptr;
+
+    // Cached values from the last step go stale the moment the rope stops carrying the character.
+    if (MoveComp == nullptr || !bRopeAttached || !(bHanging || bHoldingRope))
+    {
+        return 0.0f;
+    }
+
+    // Mass is in kg and the core works in cm/s^2, so one core unit is a centinewton per kilogram.
+    return MoveComp->Mass * 0.01f;
+}
+
+void UBPC_RopeTraversalComponent::SetSimulationActive(const bool bActive)
+{
+    if (URopeSimulationSubsystem* const Subsystem = SimulationSubsystem.Get())
+    {
+        Subsystem->SetRopeActive(SimulationSlot, bActive);
+    }
+}
+
+void UBPC_RopeTraversalComponent::SetClimbInputSign(const int32 ClimbSign)
+{
+    GetSimState().ClimbInputSign = ClimbSign;
+
+    if (ClimbSign != 0)
+    {
+        WakeRope();
+    }
+
+    // Route climb input through the movement component so saved moves replay it.
+    if (UBPC_RopeMovementComponent* const RopeMovement = GetRopeMovement())
     {
-        TickTether(DeltaTime);
+        RopeMovement->SetRopeClimbInput(ClimbSign);
     }
 }
-#pragma endregion Tick
+
+UBPC_RopeMovementComponent* UBPC_RopeTraversalComponent::GetRopeMovement() const
+{
+    return OwningCharacter.IsValid() ? Cast<UBPC_RopeMovementComponent>(OwningCharacter->GetCharacterMovement()) : nullptr;
+}
+
+bool UBPC_RopeTraversalComponent::IsMovementDriven() const
+{
+    return !bSimulateOnPhysicsThread && GetRopeMovement() != nullptr;
+}
+#pragma endregion Simulation State
 
 #pragma region Aim And Throw
 void UBPC_RopeTraversalComponent::StartAim()
@@ -127,7 +698,7 @@ void UBPC_RopeTraversalComponent::StartAim()
         bPreviewWithinRange = false;
         PreviewImpactPoint = AnchorLocation;
         PreviewImpactNormal = AnchorNormal;
-        SetComponentTickEnabled(true);
+        SetSimulationActive(true);
         return;
     }
 
@@ -136,8 +707,15 @@ void UBPC_RopeTraversalComponent::StartAim()
     bPreviewWithinRange = false;
     PreviewImpactPoint = FVector::ZeroVector;
     PreviewImpactNormal = FVector::ZeroVector;
+    AimTraceHandle = FTraceHandle();
+    bHasAimTraceView = false;
+    AimTracesIssued = 0;
+    AimTracesSkipped = 0;
+    bAimTraceIsAssist = false;
+    bAimAssistRejected = false;
+    ClearAimArcValidation();
     RopeState = ERopeState::Aiming;
-    SetComponentTickEnabled(true);
+    SetSimulationActive(true);
 }
 
 void UBPC_RopeTraversalComponent::StopAim()
@@ -154,7 +732,7 @@ void UBPC_RopeTraversalComponent::StopAim()
     if (RopeState == ERopeState::Idle || RopeState == ERopeState::Attached)
     {
         const bool bNeedsTick = bHanging || bHoldingRope;
-        SetComponentTickEnabled(bNeedsTick);
+        SetSimulationActive(bNeedsTick);
     }
 }
 
@@ -188,7 +766,7 @@ void UBPC_RopeTraversalComponent::ThrowRope()
             PreviewImpactNormal = SavedPreviewNormal;
             bPreviewWithinRange = bSavedPreviewRange;
             RopeState = ERopeState::Aiming;
-            SetComponentTickEnabled(true);
+            SetSimulationActive(true);
         }
     }
 
@@ -208,6 +786,7 @@ void UBPC_RopeTraversalComponent::ThrowRope()
 
     RopeFlightStart = OwningCharacter->GetActorLocation();
     RopeFlightTarget = PreviewImpactPoint;
+    BindAnchorComponent(PreviewImpactComponent.Get(), PreviewImpactBoneName, PreviewImpactPoint, PreviewImpactNormal);
     const float Distance = FVector::Distance(RopeFlightStart, RopeFlightTarget);
     RopeFlightDuration = Distance > KINDA_SMALL_NUMBER ? Distance / ThrowSpeed : 0.0f;
 
@@ -215,7 +794,7 @@ void UBPC_RopeTraversalComponent::ThrowRope()
     {
         AnchorLocation = RopeFlightTarget;
         AnchorNormal = PreviewImpactNormal;
-        CurrentRopeLength = FMath::Clamp(Distance, GetClimbMinLength(), MaxRopeLength);
+        GetSimState().RopeLength = FMath::Clamp(Distance, GetClimbMinLength(), MaxRopeLength);
         bRopeAttached = true;
         bHoldingRope = Distance <= MaxRopeLength;
         if (bHoldingRope)
@@ -226,30 +805,44 @@ void UBPC_RopeTraversalComponent::ThrowRope()
     }
 
     RopeFlightElapsed = 0.0f;
+    RopeFlightSweptSegments = 0;
+    bRopeFlightBlocked = false;
+    RopeFlightBlockAlpha = 1.0f;
     RopeState = ERopeState::Airborne;
-    SetComponentTickEnabled(true);
+    SetSimulationActive(true);
 }
 #pragma endregion Aim And Throw
 
 #pragma region Hold And Recall
 void UBPC_RopeTraversalComponent::ToggleHoldRequest()
 {
-    // Ignore when no rope anchor exists.
+    // Without a rope of our own, try to pick up a dropped one.
     if (!bRopeAttached)
     {
+        TryPickUpLooseRope();
         return;
     }
 
-    // Drop rope if currently holding.
+    // Drop rope if currently holding; it stays in the world as a loose rope, or is recalled when none can spawn.
     if (bHoldingRope)
     {
+        const bool bDroppedLoose = DropLooseRope();
         ReleaseRope(false);
-        BeginRecall();
-        return;
-    }
 
-    // Guard against missing owner when trying to grab.
-    if (!OwningCharacter.IsValid())
+        if (bDroppedLoose)
+        {
+            ClearRope();
+        }
+        else
+        {
+            BeginRecall();
+        }
+
+        return;
+    }
+
+    // Guard against missing owner when trying to grab.
+    if (!OwningCharacter.IsValid())
     {
         return;
     }
@@ -264,6 +857,92 @@ void UBPC_RopeTraversalComponent::ToggleHoldRequest()
     }
 }
 
+void UBPC_RopeTraversalComponent::SetNearbyLooseRope(ABPA_LooseRope* const LooseRope)
+{
+    NearbyLooseRope = LooseRope;
+}
+
+void UBPC_RopeTraversalComponent::ClearNearbyLooseRope(const ABPA_LooseRope* const LooseRope)
+{
+    if (NearbyLooseRope.Get() == LooseRope)
+    {
+        NearbyLooseRope.Reset();
+    }
+}
+
+bool UBPC_RopeTraversalComponent::DropLooseRope()
+{
+    UWorld* const World = GetWorld();
+
+    if (World == nullptr || LooseRopeClass == nullptr || !OwningCharacter.IsValid())
+    {
+        return false;
+    }
+
+    // Lay the loose rope along the rope as it is now: anchor, wrap pivots, then the simulated free segment.
+    TArray<FVector> RopePath;
+    RopePath.Reserve(RopeWrapPivots.Num() + GetSimState().Particles.Num() + 1);
+    RopePath.Add(AnchorLocation);
+
+    for (const FRopeWrapPivot& Pivot : RopeWrapPivots)
+    {
+        RopePath.Add(Pivot.Location);
+    }
+
+    if (GetSimState().Particles.IsInitialized())
+    {
+        TArray<FVector> FreePositions;
+        GetSimState().Particles.GetWorldPositions(FreePositions);
+
+        // The first particle sits on the swing pivot, which is already the last path point.
+        for (int32 Index = 1; Index < FreePositions.Num(); ++Index)
+        {
+            RopePath.Add(FreePositions[Index]);
+        }
+    }
+    else
+    {
+        RopePath.Add(OwningCharacter->GetActorLocation());
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    ABPA_LooseRope* const LooseRope = World->SpawnActor<ABPA_LooseRope>(LooseRopeClass, AnchorLocation, FRotator::ZeroRotator, SpawnParams);
+
+    if (LooseRope == nullptr)
+    {
+        return false;
+    }
+
+    LooseRope->InitializeFromDrop(AnchorNormal, RopePath, GetSimState().RopeLength);
+    return true;
+}
+
+bool UBPC_RopeTraversalComponent::TryPickUpLooseRope()
+{
+    ABPA_LooseRope* const LooseRope = NearbyLooseRope.Get();
+
+    if (LooseRope == nullptr || !OwningCharacter.IsValid())
+    {
+        return false;
+    }
+
+    // Any point along the dropped rope can be grabbed, not just its anchor.
+    if (LooseRope->GetDistanceToRope(OwningCharacter->GetActorLocation()) > GrabDistance)
+    {
+        return false;
+    }
+
+    AnchorLocation = LooseRope->GetAnchorLocation();
+    AnchorNormal = LooseRope->GetAnchorNormal();
+    BindAnchorComponent(nullptr, NAME_None, AnchorLocation, AnchorNormal);
+    bRopeAttached = true;
+    NearbyLooseRope.Reset();
+    LooseRope->Destroy();
+    EngageHoldConstraint();
+    return true;
+}
+
 void UBPC_RopeTraversalComponent::BeginRecall()
 {
     // Only recall when rope exists in world.
@@ -280,7 +959,7 @@ void UBPC_RopeTraversalComponent::BeginRecall()
         ExitHanging();
     }
     RopeState = ERopeState::Recalling;
-    SetComponentTickEnabled(true);
+    SetSimulationActive(true);
 }
 
 void UBPC_RopeTraversalComponent::CancelRecall()
@@ -290,13 +969,13 @@ void UBPC_RopeTraversalComponent::CancelRecall()
     {
         RopeState = bHanging ? ERopeState::Hanging : ERopeState::Attached;
         RecallAccumulated = 0.0f;
-        CurrentRopeLength = FMath::Max(CurrentRopeLength, GetClimbMinLength());
+        GetSimState().RopeLength = FMath::Max(GetSimState().RopeLength, GetClimbMinLength());
     }
 
     // Disable tick when nothing requires simulation.
     if (!bHanging && !bHoldingRope)
     {
-        SetComponentTickEnabled(false);
+        SetSimulationActive(false);
     }
 }
 #pragma endregion Hold And Recall
@@ -306,6 +985,41 @@ void UBPC_RopeTraversalComponent::ApplySwingInput(const FVector2D InputAxis)
 {
     // Cache swing input to apply during hanging tick.
     PendingSwingInput = InputAxis;
+
+    if (!InputAxis.IsNearlyZero())
+    {
+        WakeRope();
+    }
+}
+
+void UBPC_RopeTraversalComponent::RecordSwingInput(const FVector2D& InputAxis)
+{
+    ApplySwingInput(InputAxis);
+    PushRopeInputSample(FVector2f(InputAxis), LatestRopeInput.ClimbSign);
+}
+
+void UBPC_RopeTraversalComponent::RecordClimbInput(const int32 ClimbSign)
+{
+    PushRopeInputSample(LatestRopeInput.SwingInput, static_cast<int8>(FMath::Clamp(ClimbSign, -1, 1)));
+}
+
+void UBPC_RopeTraversalComponent::BeginRopeInputFrame(const float SimulatedSeconds)
+{
+    if (UsesSubframeInput())
+    {
+        RopeInputBuffer.BeginFrame(FPlatformTime::Seconds(), SimulatedSeconds);
+    }
+}
+
+bool UBPC_RopeTraversalComponent::ConsumeRopeInput(const float StepSeconds, FRopeInputWindow& OutWindow)
+{
+    if (!UsesSubframeInput())
+    {
+        return false;
+    }
+
+    OutWindow = RopeInputBuffer.Consume(StepSeconds);
+    return true;
 }
 
 void UBPC_RopeTraversalComponent::BeginClimbUp()
@@ -330,7 +1044,7 @@ void UBPC_RopeTraversalComponent::BeginClimbUp()
     }
 
     if (CanProcessClimbInput())
-        ClimbInputSign = 1;
+        SetClimbInputSign(1);
 }
 
 void UBPC_RopeTraversalComponent::BeginClimbDown()
@@ -342,13 +1056,13 @@ void UBPC_RopeTraversalComponent::BeginClimbDown()
     }
 
     if (CanProcessClimbInput())
-        ClimbInputSign = -1;
+        SetClimbInputSign(-1);
 }
 
 void UBPC_RopeTraversalComponent::StopClimb()
 {
     // Clear climb input when key released.
-    ClimbInputSign = 0;
+    SetClimbInputSign(0);
 }
 #pragma endregion Input Helpers
 
@@ -373,18 +1087,19 @@ void UBPC_RopeTraversalComponent::ReleaseRope(const bool bJumpRelease)
 
             if (MoveComp != nullptr)
             {
-                const FVector LaunchDir = MoveComp->Velocity.GetSafeNormal();
-                const FVector LaunchStrength = LaunchDir * 200.0f + OwningCharacter->GetActorForwardVector() * 200.0f;
-                OwningCharacter->LaunchCharacter(LaunchStrength, true, true);
+                const FVector LaunchVelocity = FRopeSimCore::GetReleaseLaunchVelocity(MoveComp->Velocity, OwningCharacter->GetActorForwardVector());
+                OwningCharacter->LaunchCharacter(LaunchVelocity, true, true);
             }
         }
     }
 
     bHoldingRope = false;
     RopeState = bRopeAttached ? ERopeState::Attached : ERopeState::Idle;
+    WakeRope();
+    ResetRopeWrap();
 
     if (!bHanging && (RopeState == ERopeState::Idle || RopeState == ERopeState::Attached))
-        SetComponentTickEnabled(false);
+        SetSimulationActive(false);
 }
 
 bool UBPC_RopeTraversalComponent::IsAttached() const
@@ -437,6 +1152,26 @@ bool UBPC_RopeTraversalComponent::IsPreviewWithinRange() const
     return bPreviewWithinRange;
 }
 
+int32 UBPC_RopeTraversalComponent::GetAimTracesIssued() const
+{
+    return AimTracesIssued;
+}
+
+int32 UBPC_RopeTraversalComponent::GetAimTracesSkipped() const
+{
+    return AimTracesSkipped;
+}
+
+bool UBPC_RopeTraversalComponent::IsPreviewArcBlocked() const
+{
+    return AimArcBlockedSegment != INDEX_NONE;
+}
+
+bool UBPC_RopeTraversalComponent::IsPreviewArcClear() const
+{
+    return AimArcSegments.Num() > 0 && !AimArcSegments.ContainsByPredicate([](const ERopeReleaseSegment Segment) { return Segment != ERopeReleaseSegment::Clear; });
+}
+
 bool UBPC_RopeTraversalComponent::IsRecalling() const
 {
     return RopeState == ERopeState::Recalling;
@@ -449,7 +1184,168 @@ bool UBPC_RopeTraversalComponent::IsRopeInFlight() const
 
 float UBPC_RopeTraversalComponent::GetCurrentRopeLength() const
 {
-    return CurrentRopeLength;
+    return GetSimState().RopeLength;
+}
+
+bool UBPC_RopeTraversalComponent::IsRopeSimulated() const
+{
+    return bRopeAttached && (bHanging || bHoldingRope) && !IsRopeKinematic() && GetSimState().Particles.IsInitialized();
+}
+
+bool UBPC_RopeTraversalComponent::IsRopeAsleep() const
+{
+    return bRopeAsleep;
+}
+
+void UBPC_RopeTraversalComponent::WakeRope()
+{
+    RopeQuietFrames = 0;
+    SleepCheckRopeLength = GetSimState().RopeLength;
+
+    if (!bRopeAsleep)
+    {
+        return;
+    }
+
+    bRopeAsleep = false;
+
+    if (OwningCharacter.IsValid())
+    {
+        UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+
+        if (bHanging && MoveComp != nullptr)
+        {
+            MoveComp->GravityScale = SavedGravityScale;
+        }
+
+        LastWrapEndLocation = OwningCharacter->GetActorLocation();
+    }
+
+    // Physics-thread state went stale while asleep; the clock reset rebuilds it from the current pose.
+    ResetSimulationClock();
+}
+
+float UBPC_RopeTraversalComponent::GetRopeTension() const
+{
+    return GetSimState().Tension * GetRopeForceScale();
+}
+
+float UBPC_RopeTraversalComponent::GetRopeTensionRatio() const
+{
+    const UCharacterMovementComponent* const MoveComp = OwningCharacter.IsValid() ? OwningCharacter->GetCharacterMovement() : nullptr;
+    const float Weight = MoveComp != nullptr ? FMath::Abs(MoveComp->GetGravityZ()) : 0.0f;
+    return Weight > KINDA_SMALL_NUMBER && GetRopeForceScale() > 0.0f ? GetSimState().Tension / Weight : 0.0f;
+}
+
+FVector UBPC_RopeTraversalComponent::GetRopeConstraintImpulse() const
+{
+    return GetSimState().ConstraintImpulse * GetRopeForceScale();
+}
+
+int32 UBPC_RopeTraversalComponent::GetRopeSegmentCount() const
+{
+    return GetSimState().Particles.GetSegmentCount();
+}
+
+float UBPC_RopeTraversalComponent::GetRopeSegmentTension(const int32 Segment) const
+{
+    // Segment tensions are per unit particle mass; the character end weighs one over its inverse mass in particles.
+    return GetSimState().Particles.GetSegmentTension(Segment) * GetRopeForceScale() * RopeCharacterInverseMass;
+}
+
+void UBPC_RopeTraversalComponent::GetRopeSegmentTensions(TArray<float>& OutTensions) const
+{
+    const TArray<float>& SegmentTensions = GetSimState().Particles.GetSegmentTensions();
+    const float Scale = GetRopeForceScale() * RopeCharacterInverseMass;
+    OutTensions.SetNumUninitialized(SegmentTensions.Num());
+
+    for (int32 Segment = 0; Segment < SegmentTensions.Num(); ++Segment)
+    {
+        OutTensions[Segment] = SegmentTensions[Segment] * Scale;
+    }
+}
+
+void UBPC_RopeTraversalComponent::GetRopeParticlePositions(TArray<FVector>& OutPositions) const
+{
+    GetSimState().Particles.GetWorldPositions(OutPositions);
+}
+
+const TArray<FVector>& UBPC_RopeTraversalComponent::GetRopeRenderPositions() const
+{
+    return RopeRenderPositions;
+}
+
+const TArray<FRopeWrapPivot>& UBPC_RopeTraversalComponent::GetRopeWrapPivots() const
+{
+    return RopeWrapPivots;
+}
+
+void UBPC_RopeTraversalComponent::UpdateRopeSignificance(const float ViewDistance, const bool bRecentlyRendered)
+{
+    ERopeSignificance NewSignificance = ERopeSignificance::Full;
+
+    // The local player's own rope always runs at full fidelity.
+    const bool bLocalPlayer = OwningCharacter.IsValid() && OwningCharacter->IsPlayerControlled() && OwningCharacter->IsLocallyControlled();
+
+    if (!bLocalPlayer)
+    {
+        const int32 LastBucket = static_cast<int32>(ERopeSignificance::Count) - 1;
+        int32 Bucket = 0;
+
+        while (Bucket < LastBucket && ViewDistance > SignificanceBudgets[Bucket].MaxViewDistance)
+        {
+            ++Bucket;
+        }
+
+        if (!bRecentlyRendered)
+        {
+            Bucket = FMath::Max(Bucket, static_cast<int32>(OffscreenSignificance));
+        }
+
+        NewSignificance = static_cast<ERopeSignificance>(FMath::Min(Bucket, LastBucket));
+    }
+
+    if (NewSignificance == RopeSignificance)
+    {
+        return;
+    }
+
+    const bool bWasKinematic = IsRopeKinematic();
+    RopeSignificance = NewSignificance;
+
+    if (bWasKinematic == IsRopeKinematic())
+    {
+        return;
+    }
+
+    // The chain went stale while kinematic; rebuild it and any physics-thread state from the current pose.
+    if (!IsRopeKinematic() && bRopeAttached && (bHanging || bHoldingRope))
+    {
+        InitializeRopeParticles();
+    }
+
+    ResetSimulationClock();
+}
+
+ERopeSignificance UBPC_RopeTraversalComponent::GetRopeSignificance() const
+{
+    return RopeSignificance;
+}
+
+const FRopeSignificanceBudget& UBPC_RopeTraversalComponent::GetSignificanceBudget() const
+{
+    return SignificanceBudgets[static_cast<int32>(RopeSignificance)];
+}
+
+bool UBPC_RopeTraversalComponent::IsRopeKinematic() const
+{
+    // Only replicated characters can skip the solve; anywhere else the rope drives gameplay movement.
+    return GetSignificanceBudget().bKinematic && OwningCharacter.IsValid() && OwningCharacter->GetLocalRole() == ROLE_SimulatedProxy;
+}
+
+FVector UBPC_RopeTraversalComponent::GetSwingPivot() const
+{
+    return RopeWrapPivots.Num() > 0 ? RopeWrapPivots.Last().Location : AnchorLocation;
 }
 
 bool UBPC_RopeTraversalComponent::RequestLedgeClimbFromJump()
@@ -475,7 +1371,7 @@ bool UBPC_RopeTraversalComponent::RequestLedgeClimbFromJump()
     }
 
     const float AnchorDistance = GetDistanceToAnchor();
-    const float EffectiveDistance = FMath::Min(CurrentRopeLength, AnchorDistance);
+    const float EffectiveDistance = FMath::Min(GetSimState().RopeLength, AnchorDistance);
     const bool bWithinAssistDistance = EffectiveDistance <= AnchorAssistDistance + 8.0f;
 
     if (bDebugRopeAssist)
@@ -504,374 +1400,1371 @@ bool UBPC_RopeTraversalComponent::RequestLedgeClimbFromJump()
 
     return bClimbed;
 }
+
+void UBPC_RopeTraversalComponent::GetLedgeRules(float& OutProbeRadius, float& OutNormalDotThreshold, float& OutStandOffDistance) const
+{
+    OutProbeRadius = LedgeProbeRadius;
+    OutNormalDotThreshold = LedgeNormalDotThreshold;
+    OutStandOffDistance = LedgeStandOffDistance;
+}
 #pragma endregion Release And Query
 
-#pragma region Helpers
-void UBPC_RopeTraversalComponent::UpdateAimPreview()
+#pragma region Moving Anchor
+void UBPC_RopeTraversalComponent::BindAnchorComponent(UPrimitiveComponent* const Component, const FName BoneName, const FVector& Location, const FVector& Normal)
 {
-    // Skip when no owner exists.
-    if (!OwningCharacter.IsValid())
+    PendingAnchorImpulse = 0.0f;
+
+    // Static and stationary geometry never moves, so the anchor stays a plain world point with no per-frame lookup.
+    if (Component == nullptr || Component->Mobility != EComponentMobility::Movable)
     {
-        bHasPreview = false;
+        AnchorComponent.Reset();
+        AnchorBoneName = NAME_None;
         return;
     }
 
-    // Read camera viewpoint to align aim trace.
-    FVector ViewLocation = FVector::ZeroVector;
-    FRotator ViewRotation = FRotator::ZeroRotator;
+    const FTransform AnchorFrame = Component->GetSocketTransform(BoneName);
+    AnchorComponent = Component;
+    AnchorBoneName = BoneName;
+    AnchorRelativeLocation = AnchorFrame.InverseTransformPosition(Location);
+    AnchorRelativeNormal = AnchorFrame.InverseTransformVectorNoScale(Normal);
+}
 
-    if (APlayerController* const PC = Cast<APlayerController>(OwningCharacter->GetController()))
+bool UBPC_RopeTraversalComponent::SampleAnchorComponent(FVector& OutLocation, FVector& OutNormal) const
+{
+    const UPrimitiveComponent* const Component = AnchorComponent.Get();
+
+    if (Component == nullptr)
     {
-        PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        return false;
     }
-    else
+
+    // The component transform is cached by the engine; a bone adds one pose lookup.
+    const FTransform AnchorFrame = AnchorBoneName.IsNone() ? Component->GetComponentTransform() : Component->GetSocketTransform(AnchorBoneName);
+    OutLocation = AnchorFrame.TransformPosition(AnchorRelativeLocation);
+    OutNormal = AnchorFrame.TransformVectorNoScale(AnchorRelativeNormal);
+    return true;
+}
+
+void UBPC_RopeTraversalComponent::UpdateMovingAnchor()
+{
+    UPrimitiveComponent* const Component = AnchorComponent.Get();
+
+    if (Component == nullptr)
     {
-        ViewLocation = OwningCharacter->GetActorLocation();
-        ViewRotation = OwningCharacter->GetActorRotation();
+        // A destroyed prop leaves the anchor where it was last seen.
+        AnchorComponent.Reset();
+        return;
     }
 
-    // Perform line trace for preview impact point.
-    const FVector TraceStart = ViewLocation;
-    const FVector TraceEnd = TraceStart + ViewRotation.Vector() * MaxRopeLength;
+    // The rope pulls the anchor toward the next point along it: the first wrap pivot, or the character.
+    if (PendingAnchorImpulse > KINDA_SMALL_NUMBER && Component->IsSimulatingPhysics(AnchorBoneName) && OwningCharacter.IsValid())
+    {
+        const FVector NextPoint = RopeWrapPivots.Num() > 0 ? RopeWrapPivots[0].Location : OwningCharacter->GetActorLocation();
+        const FVector PullDirection = (NextPoint - AnchorLocation).GetSafeNormal();
+        Component->AddImpulseAtLocation(PullDirection * PendingAnchorImpulse * AnchorReactionScale, AnchorLocation, AnchorBoneName);
+    }
 
-    FHitResult HitResult;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(OwningCharacter.Get());
+    PendingAnchorImpulse = 0.0f;
+
+    FVector SampledLocation;
+    FVector SampledNormal;
+    SampleAnchorComponent(SampledLocation, SampledNormal);
+
+    // Wrap pivots stay on the world geometry they were traced against; only the anchor itself rides the component.
+    if (!SampledLocation.Equals(AnchorLocation, KINDA_SMALL_NUMBER))
+    {
+        AnchorLocation = SampledLocation;
+        AnchorNormal = SampledNormal;
+
+        // A moving anchor disturbs the rope even when the character is still.
+        WakeRope();
+    }
+}
+
+void UBPC_RopeTraversalComponent::AccumulateAnchorReaction(const float StepSeconds)
+{
+    const UCharacterMovementComponent* const MoveComp = OwningCharacter.IsValid() ? OwningCharacter->GetCharacterMovement() : nullptr;
+
+    if (!AnchorComponent.IsValid() || MoveComp == nullptr || AnchorReactionScale <= 0.0f)
+    {
+        return;
+    }
+
+    // Tension is per unit character mass in cm/s^2, so mass times seconds gives the impulse in the engine's kg cm/s.
+    PendingAnchorImpulse += GetSimState().Tension * MoveComp->Mass * StepSeconds;
+}
+#pragma endregion Moving Anchor
+
+#pragma region Release Preview
+const TArray<FVector>& UBPC_RopeTraversalComponent::GetReleasePreviewPoints() const
+{
+    return ReleasePreviewPoints;
+}
+
+bool UBPC_RopeTraversalComponent::GetReleasePreviewLanding(FVector& OutLocation, FVector& OutNormal) const
+{
+    if (ReleasePreviewBlockedSegment == INDEX_NONE || ReleasePreviewPoints.Num() == 0)
+    {
+        return false;
+    }
+
+    OutLocation = ReleasePreviewHit.ImpactPoint;
+    OutNormal = ReleasePreviewHit.ImpactNormal;
+    return true;
+}
+
+void UBPC_RopeTraversalComponent::UpdateReleasePreview()
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeReleasePreview);
+
+    UWorld* const World = GetWorld();
+    const UCharacterMovementComponent* const MoveComp = OwningCharacter.IsValid() ? OwningCharacter->GetCharacterMovement() : nullptr;
 
-    const bool bHit = GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_Visibility, Params);
+    // Only the local player sees the preview; other hanging characters never pay for it.
+    if (!bShowReleasePreview || World == nullptr || MoveComp == nullptr || !OwningCharacter->IsLocallyControlled() || !OwningCharacter->IsPlayerControlled())
+    {
+        ClearReleasePreview();
+        return;
+    }
+
+    const double BudgetEnd = FPlatformTime::Seconds() + ReleasePreviewBudgetMs * 0.001;
+    const float SampleSeconds = FMath::Max(ReleasePreviewSampleSeconds, 0.01f);
+    const int32 SampleCount = FMath::Clamp(FMath::CeilToInt32(ReleasePreviewSeconds / SampleSeconds), 1, RopeReleasePreview::MaxSegments) + 1;
+    const FVector Start = OwningCharacter->GetActorLocation();
+    const FVector LaunchVelocity = FRopeSimCore::GetReleaseLaunchVelocity(MoveComp->Velocity, OwningCharacter->GetActorForwardVector());
+
+    // Hanging may hold gravity scale at zero; the release restores the saved scale before the character falls.
+    const FVector Gravity(0.0f, 0.0f, World->GetGravityZ() * SavedGravityScale);
+
+    // Keep the cached prefix whose samples moved less than the sweep margin; only the rest is re-simulated.
+    int32 FirstChanged = ReleasePreviewSamples.Num() == SampleCount ? SampleCount : 0;
+
+    for (int32 Index = 0; Index < FirstChanged; ++Index)
+    {
+        const FVector Sample = FRopeSimCore::EvaluateBallisticArc(Start, LaunchVelocity, Gravity, Index * SampleSeconds);
+
+        if (FVector::DistSquared(Sample, ReleasePreviewSamples[Index]) > FMath::Square(ReleasePreviewTolerance))
+        {
+            FirstChanged = Index;
+            break;
+        }
+    }
+
+    if (FirstChanged < SampleCount)
+    {
+        ReleasePreviewSamples.SetNum(SampleCount);
+        ReleasePreviewSegments.SetNum(SampleCount - 1);
+        ReleasePreviewTraces.SetNum(SampleCount - 1);
+
+        for (int32 Index = FirstChanged; Index < SampleCount; ++Index)
+        {
+            ReleasePreviewSamples[Index] = FRopeSimCore::EvaluateBallisticArc(Start, LaunchVelocity, Gravity, Index * SampleSeconds);
+        }
+
+        // A moved sample invalidates both segments that touch it; sweeps still in flight for them are discarded.
+        const int32 FirstInvalid = FMath::Max(FirstChanged - 1, 0);
+
+        for (int32 Segment = FirstInvalid; Segment < SampleCount - 1; ++Segment)
+        {
+            ReleasePreviewSegments[Segment] = ERopeReleaseSegment::Unswept;
+            ReleasePreviewTraces[Segment] = FTraceHandle();
+        }
+
+        if (ReleasePreviewBlockedSegment >= FirstInvalid)
+        {
+            ReleasePreviewBlockedSegment = INDEX_NONE;
+        }
+    }
+
+    // Sweeps issued last frame have completed; their results are only readable during this frame.
+    for (int32 Segment = 0; Segment < ReleasePreviewSegments.Num(); ++Segment)
+    {
+        if (ReleasePreviewSegments[Segment] != ERopeReleaseSegment::Pending)
+        {
+            continue;
+        }
+
+        FTraceDatum TraceData;
+
+        if (World->QueryTraceData(ReleasePreviewTraces[Segment], TraceData))
+        {
+            // Starting inside the inflated margin is not a landing; a real contact shows up on an earlier segment.
+            const bool bBlocked = TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit && !TraceData.OutHits[0].bStartPenetrating;
+            ReleasePreviewSegments[Segment] = bBlocked ? ERopeReleaseSegment::Blocked : ERopeReleaseSegment::Clear;
+
+            if (bBlocked && (ReleasePreviewBlockedSegment == INDEX_NONE || Segment < ReleasePreviewBlockedSegment))
+            {
+                ReleasePreviewBlockedSegment = Segment;
+                ReleasePreviewHit = TraceData.OutHits[0];
+            }
+        }
+        else if (!World->IsTraceHandleValid(ReleasePreviewTraces[Segment], false))
+        {
+            ReleasePreviewSegments[Segment] = ERopeReleaseSegment::Unswept;
+        }
+    }
+
+    // Sweep the earliest unknown segments first; nothing past the first blocked segment matters.
+    const int32 LastSegment = ReleasePreviewBlockedSegment != INDEX_NONE ? ReleasePreviewBlockedSegment : ReleasePreviewSegments.Num() - 1;
+    int32 IssuedSweeps = 0;
+
+    if (const UCapsuleComponent* const Capsule = OwningCharacter->GetCapsuleComponent())
+    {
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeReleasePreview), false, GetOwner());
+        FCollisionResponseParams ResponseParams;
+        Capsule->InitSweepCollisionParams(Params, ResponseParams);
+
+        // Inflating by the tolerance keeps a clear result valid for any arc within the tolerance of the swept one.
+        const FCollisionShape Shape = FCollisionShape::MakeCapsule(Capsule->GetScaledCapsuleRadius() + ReleasePreviewTolerance, Capsule->GetScaledCapsuleHalfHeight() + ReleasePreviewTolerance);
+        const ECollisionChannel Channel = Capsule->GetCollisionObjectType();
+
+        for (int32 Segment = 0; Segment <= LastSegment && IssuedSweeps < ReleasePreviewMaxSweepsPerFrame; ++Segment)
+        {
+            if (ReleasePreviewSegments[Segment] != ERopeReleaseSegment::Unswept)
+            {
+                continue;
+            }
+
+            // At least one sweep per frame so the preview converges even when the budget is already spent.
+            if (IssuedSweeps > 0 && FPlatformTime::Seconds() > BudgetEnd)
+            {
+                break;
+            }
+
+            ReleasePreviewTraces[Segment] = World->AsyncSweepByChannel(EAsyncTraceType::Single, ReleasePreviewSamples[Segment], ReleasePreviewSamples[Segment + 1], FQuat::Identity, Channel, Shape, Params, ResponseParams);
+            ReleasePreviewSegments[Segment] = ERopeReleaseSegment::Pending;
+            ++IssuedSweeps;
+        }
+    }
+
+    INC_DWORD_STAT_BY(STAT_RopeReleasePreviewSweeps, IssuedSweeps);
+
+    // Segments not yet swept are still drawn; the path only ends early at a confirmed hit.
+    ReleasePreviewPoints.Reset(SampleCount + 1);
+    ReleasePreviewPoints.Append(ReleasePreviewSamples.GetData(), LastSegment + 1);
+    ReleasePreviewPoints.Add(ReleasePreviewBlockedSegment != INDEX_NONE ? ReleasePreviewHit.Location : ReleasePreviewSamples.Last());
+}
+
+void UBPC_RopeTraversalComponent::ClearReleasePreview()
+{
+    ReleasePreviewSamples.Reset();
+    ReleasePreviewSegments.Reset();
+    ReleasePreviewTraces.Reset();
+    ReleasePreviewPoints.Reset();
+    ReleasePreviewBlockedSegment = INDEX_NONE;
+}
+
+void UBPC_RopeTraversalComponent::UpdateAimArcValidation()
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeAimArcValidation);
+
+    UWorld* const World = GetWorld();
+
+    // Out-of-range targets already show as unreachable; nothing to sweep.
+    if (World == nullptr || !OwningCharacter.IsValid() || !bHasPreview || !bPreviewWithinRange)
+    {
+        ClearAimArcValidation();
+        return;
+    }
+
+    const FVector Start = OwningCharacter->GetActorLocation();
+    const float CellSize = FMath::Max(AimArcCellSize, 1.0f);
+    const FIntVector StartCell(FMath::FloorToInt32(Start.X / CellSize), FMath::FloorToInt32(Start.Y / CellSize), FMath::FloorToInt32(Start.Z / CellSize));
+    const FIntVector TargetCell(FMath::FloorToInt32(PreviewImpactPoint.X / CellSize), FMath::FloorToInt32(PreviewImpactPoint.Y / CellSize), FMath::FloorToInt32(PreviewImpactPoint.Z / CellSize));
+
+    // Same segments and tip radius the flight sweeps, so a clear preview means the throw will land.
+    if (AimArcSamples.Num() == 0 || StartCell != AimArcStartCell || TargetCell != AimArcTargetCell)
+    {
+        const int32 SegmentCount = FMath::Max(RopeFlightSweepSegments, 1);
+        AimArcStartCell = StartCell;
+        AimArcTargetCell = TargetCell;
+        AimArcSamples.SetNum(SegmentCount + 1);
+        AimArcSegments.Init(ERopeReleaseSegment::Unswept, SegmentCount);
+        AimArcTraces.Init(FTraceHandle(), SegmentCount);
+        AimArcBlockedSegment = INDEX_NONE;
+
+        for (int32 Index = 0; Index <= SegmentCount; ++Index)
+        {
+            AimArcSamples[Index] = FRopeSimCore::EvaluateFlightArc(Start, PreviewImpactPoint, static_cast<float>(Index) / SegmentCount);
+        }
+    }
+
+    // The arc ends on the target; touching it there, or anywhere on the aimed component, is the landing rather than a block.
+    const float LandingTolerance = CellSize + RopeFlightSweepRadius;
+    const UPrimitiveComponent* const TargetComponent = PreviewImpactComponent.Get();
+
+    for (int32 Segment = 0; Segment < AimArcSegments.Num(); ++Segment)
+    {
+        if (AimArcSegments[Segment] != ERopeReleaseSegment::Pending)
+        {
+            continue;
+        }
+
+        FTraceDatum TraceData;
+
+        if (World->QueryTraceData(AimArcTraces[Segment], TraceData))
+        {
+            const FHitResult* const Hit = TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit ? &TraceData.OutHits[0] : nullptr;
+            const bool bLanding = Hit != nullptr
+                && ((TargetComponent != nullptr && Hit->GetComponent() == TargetComponent)
+                    || FVector::DistSquared(Hit->ImpactPoint, AimArcSamples.Last()) <= FMath::Square(LandingTolerance));
+            const bool bBlocked = Hit != nullptr && !bLanding;
+            AimArcSegments[Segment] = bBlocked ? ERopeReleaseSegment::Blocked : ERopeReleaseSegment::Clear;
+
+            if (bBlocked && (AimArcBlockedSegment == INDEX_NONE || Segment < AimArcBlockedSegment))
+            {
+                AimArcBlockedSegment = Segment;
+            }
+        }
+        else if (!World->IsTraceHandleValid(AimArcTraces[Segment], false))
+        {
+            AimArcSegments[Segment] = ERopeReleaseSegment::Unswept;
+        }
+    }
+
+    // Sweep the earliest unknown segments first; nothing past the first blocked segment matters.
+    const int32 LastSegment = AimArcBlockedSegment != INDEX_NONE ? AimArcBlockedSegment : AimArcSegments.Num() - 1;
+    int32 IssuedSweeps = 0;
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeAimArc), false, GetOwner());
+    const FCollisionShape TipShape = FCollisionShape::MakeSphere(RopeFlightSweepRadius);
+
+    for (int32 Segment = 0; Segment <= LastSegment && IssuedSweeps < AimArcMaxSweepsPerFrame; ++Segment)
+    {
+        if (AimArcSegments[Segment] != ERopeReleaseSegment::Unswept)
+        {
+            continue;
+        }
+
+        AimArcTraces[Segment] = World->AsyncSweepByChannel(EAsyncTraceType::Single, AimArcSamples[Segment], AimArcSamples[Segment + 1], FQuat::Identity, ECC_Visibility, TipShape, Params);
+        AimArcSegments[Segment] = ERopeReleaseSegment::Pending;
+        ++IssuedSweeps;
+    }
+
+    INC_DWORD_STAT_BY(STAT_RopeAimArcSweeps, IssuedSweeps);
+}
+
+void UBPC_RopeTraversalComponent::ClearAimArcValidation()
+{
+    AimArcSamples.Reset();
+    AimArcSegments.Reset();
+    AimArcTraces.Reset();
+    AimArcBlockedSegment = INDEX_NONE;
+}
+#pragma endregion Release Preview
+
+#pragma region Helpers
+void UBPC_RopeTraversalComponent::UpdateAimPreview()
+{
+    UWorld* const World = GetWorld();
+
+    // Skip when no owner exists.
+    if (!OwningCharacter.IsValid() || World == nullptr)
+    {
+        bHasPreview = false;
+        return;
+    }
+
+    // Last frame's trace has completed; its result is only readable during this frame.
+    if (AimTraceHandle.IsValid())
+    {
+        FTraceDatum TraceData;
+
+        if (World->QueryTraceData(AimTraceHandle, TraceData))
+        {
+            const FHitResult* const HitResult = TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit ? &TraceData.OutHits[0] : nullptr;
+
+            if (bAimTraceIsAssist)
+            {
+                // The anchor is confirmed when nothing blocks it or the trace stops on the anchor itself.
+                const bool bOnAnchor = HitResult != nullptr
+                    && ((AimAssistCandidate.Owner.IsValid() && HitResult->GetActor() == AimAssistCandidate.Owner.Get())
+                        || FVector::DistSquared(HitResult->ImpactPoint, AimAssistCandidate.Location) <= FMath::Square(AimAssistCandidate.Radius + RopeAimAssist::ConfirmOvershoot));
+
+                if (HitResult == nullptr || bOnAnchor)
+                {
+                    bHasPreview = true;
+                    PreviewImpactPoint = AimAssistCandidate.Location;
+                    PreviewImpactNormal = AimAssistCandidate.Normal;
+                    PreviewImpactComponent = bOnAnchor ? HitResult->GetComponent() : nullptr;
+                    PreviewImpactBoneName = bOnAnchor ? HitResult->BoneName : NAME_None;
+                }
+                else
+                {
+                    // Blocked; the next trace follows the crosshair instead of retrying the same anchor.
+                    bAimAssistRejected = true;
+                    bHasAimTraceView = false;
+                }
+            }
+            else
+            {
+                bHasPreview = HitResult != nullptr;
+
+                if (HitResult != nullptr)
+                {
+                    PreviewImpactPoint = HitResult->ImpactPoint;
+                    PreviewImpactNormal = HitResult->ImpactNormal;
+                    PreviewImpactComponent = HitResult->GetComponent();
+                    PreviewImpactBoneName = HitResult->BoneName;
+                }
+            }
+
+            AimTraceHandle = FTraceHandle();
+        }
+        else if (!World->IsTraceHandleValid(AimTraceHandle, false))
+        {
+            // The result was dropped; force a fresh trace below.
+            AimTraceHandle = FTraceHandle();
+            bHasAimTraceView = false;
+        }
+    }
+
+    // Range follows the character every frame even when the hit is reused.
+    bPreviewWithinRange = bHasPreview && FVector::Distance(OwningCharacter->GetActorLocation(), PreviewImpactPoint) <= MaxRopeLength;
+
+    // The arc check runs every frame; it is cached per target cell and only sweeps after the cell changes.
+    UpdateAimArcValidation();
+
+    // Read camera viewpoint to align aim trace.
+    FVector ViewLocation = FVector::ZeroVector;
+    FRotator ViewRotation = FRotator::ZeroRotator;
+
+    if (APlayerController* const PC = Cast<APlayerController>(OwningCharacter->GetController()))
+    {
+        PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+    }
+    else
+    {
+        ViewLocation = OwningCharacter->GetActorLocation();
+        ViewRotation = OwningCharacter->GetActorRotation();
+    }
+
+    // A still view over static geometry sees the same hit; a movable target may slide out from under the crosshair.
+    const UPrimitiveComponent* const ImpactComponent = PreviewImpactComponent.Get();
+    const bool bMovableTarget = bHasPreview && ImpactComponent != nullptr && ImpactComponent->Mobility == EComponentMobility::Movable;
+    const bool bViewChanged = !bHasAimTraceView
+        || FVector::DistSquared(ViewLocation, LastAimTraceLocation) > FMath::Square(AimTraceLocationEpsilon)
+        || !ViewRotation.Equals(LastAimTraceRotation, AimTraceRotationEpsilon);
+
+    if (AimTraceHandle.IsValid() || (!bViewChanged && !bMovableTarget))
+    {
+        ++AimTracesSkipped;
+        INC_DWORD_STAT(STAT_RopeAimTracesSkipped);
+        return;
+    }
+
+    // Trace for the preview impact point; the result lands next frame.
+    const FVector TraceStart = ViewLocation;
+    FVector TraceEnd = TraceStart + ViewRotation.Vector() * MaxRopeLength;
+    bAimTraceIsAssist = false;
+
+    // One grid query picks the best anchor in the cone; the single trace below then confirms it instead of the crosshair.
+    if (bUseAimAssist && !bAimAssistRejected)
+    {
+        if (URopeAnchorRegistrySubsystem* const Registry = World->GetSubsystem<URopeAnchorRegistrySubsystem>())
+        {
+            if (Registry->FindBestAnchorInCone(TraceStart, ViewRotation.Vector(), MaxRopeLength, AimAssistHalfAngle, AimAssistDistanceWeight, AimAssistCandidate))
+            {
+                const FVector ToCandidate = AimAssistCandidate.Location - TraceStart;
+                TraceEnd = AimAssistCandidate.Location + ToCandidate.GetSafeNormal() * RopeAimAssist::ConfirmOvershoot;
+                bAimTraceIsAssist = true;
+            }
+        }
+    }
+
+    bAimAssistRejected = false;
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeAimPreview), false);
+    Params.AddIgnoredActor(OwningCharacter.Get());
+
+    AimTraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, ECC_Visibility, Params);
+    LastAimTraceLocation = ViewLocation;
+    LastAimTraceRotation = ViewRotation;
+    bHasAimTraceView = true;
+    ++AimTracesIssued;
+    INC_DWORD_STAT(STAT_RopeAimTracesIssued);
+}
+
+void UBPC_RopeTraversalComponent::TickRopeFlight(const float DeltaTime)
+{
+    RopeFlightElapsed += DeltaTime;
+
+    // The rope tip homes on the grapple point as it moves; the arc bends toward the latest target.
+    SampleAnchorComponent(RopeFlightTarget, PreviewImpactNormal);
+
+    const float Alpha = FRopeSimCore::GetFlightAlpha(RopeFlightElapsed, RopeFlightDuration);
+    SweepRopeFlight(Alpha);
+
+    // The tip has reached geometry swept ahead of it.
+    if (bRopeFlightBlocked && Alpha >= RopeFlightBlockAlpha)
+    {
+        CompleteBlockedRopeFlight();
+        return;
+    }
+
+    AnchorLocation = FRopeSimCore::EvaluateFlightArc(RopeFlightStart, RopeFlightTarget, Alpha);
+
+    if (Alpha >= 1.0f - KINDA_SMALL_NUMBER)
+        CompleteRopeFlight();
+}
+
+void UBPC_RopeTraversalComponent::SweepRopeFlight(const float Alpha)
+{
+    UWorld* const World = GetWorld();
+
+    if (World == nullptr || bRopeFlightBlocked)
+    {
+        return;
+    }
+
+    // Segments are fixed fractions of the throw, so a throw costs the same queries at any frame rate; sweeping the
+    // segment the tip is in keeps collision ahead of what is drawn.
+    const int32 SegmentCount = FMath::Max(RopeFlightSweepSegments, 1);
+    const int32 SweepThrough = FMath::Min(FMath::CeilToInt32(Alpha * SegmentCount), SegmentCount);
+
+    if (RopeFlightSweptSegments >= SweepThrough)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_RopeFlightSweep);
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeFlightSweep), false);
+    Params.AddIgnoredActor(GetOwner());
+    const FCollisionShape TipShape = FCollisionShape::MakeSphere(RopeFlightSweepRadius);
+
+    while (RopeFlightSweptSegments < SweepThrough)
+    {
+        const float SegmentStartAlpha = static_cast<float>(RopeFlightSweptSegments) / SegmentCount;
+        const float SegmentEndAlpha = static_cast<float>(RopeFlightSweptSegments + 1) / SegmentCount;
+        const FVector SegmentStart = FRopeSimCore::EvaluateFlightArc(RopeFlightStart, RopeFlightTarget, SegmentStartAlpha);
+        const FVector SegmentEnd = FRopeSimCore::EvaluateFlightArc(RopeFlightStart, RopeFlightTarget, SegmentEndAlpha);
+        ++RopeFlightSweptSegments;
+        INC_DWORD_STAT(STAT_RopeFlightSweeps);
+
+        if (World->SweepSingleByChannel(RopeFlightBlockHit, SegmentStart, SegmentEnd, FQuat::Identity, ECC_Visibility, TipShape, Params))
+        {
+            bRopeFlightBlocked = true;
+            RopeFlightBlockAlpha = FMath::Lerp(SegmentStartAlpha, SegmentEndAlpha, RopeFlightBlockHit.Time);
+            return;
+        }
+    }
+}
+
+void UBPC_RopeTraversalComponent::CompleteBlockedRopeFlight()
+{
+    // Characters cannot hold a grapple; the throw fails and the rope returns.
+    if (Cast<APawn>(RopeFlightBlockHit.GetActor()) != nullptr)
+    {
+        ClearRope();
+        return;
+    }
+
+    // The rope holds wherever the tip struck; reach follows the new anchor rather than the aimed one.
+    RopeFlightTarget = RopeFlightBlockHit.ImpactPoint;
+    PreviewImpactPoint = RopeFlightBlockHit.ImpactPoint;
+    PreviewImpactNormal = RopeFlightBlockHit.ImpactNormal;
+    PreviewImpactComponent = RopeFlightBlockHit.GetComponent();
+    PreviewImpactBoneName = RopeFlightBlockHit.BoneName;
+    bPreviewWithinRange = OwningCharacter.IsValid() && FVector::Distance(OwningCharacter->GetActorLocation(), RopeFlightTarget) <= MaxRopeLength;
+    BindAnchorComponent(PreviewImpactComponent.Get(), PreviewImpactBoneName, PreviewImpactPoint, PreviewImpactNormal);
+    CompleteRopeFlight();
+}
+
+void UBPC_RopeTraversalComponent::CompleteRopeFlight()
+{
+    RopeFlightElapsed = 0.0f;
+    RopeState = ERopeState::Attached;
+    AnchorLocation = RopeFlightTarget;
+    AnchorNormal = PreviewImpactNormal;
+    GetSimState().RopeLength = FMath::Clamp(FVector::Distance(OwningCharacter.IsValid() ? OwningCharacter->GetActorLocation() : RopeFlightStart, AnchorLocation), GetClimbMinLength(), MaxRopeLength);
+    bRopeAttached = true;
+    bHoldingRope = bPreviewWithinRange;
+    if (bHoldingRope)
+        EngageHoldConstraint();
+    else
+        SetSimulationActive(false);
+}
+
+void UBPC_RopeTraversalComponent::EnterHanging()
+{
+    // Ensure owner is valid before changing movement.
+    if (!OwningCharacter.IsValid())
+    {
+        return;
+    }
+
+    // Avoid duplicate transitions.
+    if (bHanging)
+    {
+        return;
+    }
+
+    // Switch to falling while keeping gravity for natural rope tension.
+    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+
+    if (MoveComp == nullptr)
+    {
+        return;
+    }
+
+    WakeRope();
+    SavedGravityScale = MoveComp->GravityScale;
+
+    if (UBPC_RopeMovementComponent* const RopeMovement = GetRopeMovement())
+    {
+        RopeMovement->SetMovementMode(MOVE_Custom, static_cast<uint8>(ERopeMovementMode::RopeSwing));
+    }
+    else
+    {
+        MoveComp->SetMovementMode(MOVE_Falling);
+    }
+
+    MoveComp->GravityScale = SavedGravityScale;
+    MoveComp->Velocity = FRopeSimCore::RemoveRadialVelocity(GetSwingPivot(), OwningCharacter->GetActorLocation(), MoveComp->Velocity);
+    bHanging = true;
+    RopeState = ERopeState::Hanging;
+    ResetSimulationClock();
+    SetSimulationActive(true);
+}
+
+void UBPC_RopeTraversalComponent::ExitHanging()
+{
+    // Restore movement mode and gravity when leaving rope hang.
+    if (!OwningCharacter.IsValid())
+    {
+        return;
+    }
+
+    WakeRope();
+    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+
+    if (MoveComp != nullptr)
+    {
+        MoveComp->GravityScale = SavedGravityScale;
+        MoveComp->SetMovementMode(MoveComp->IsMovingOnGround() ? MOVE_Walking : MOVE_Falling);
+    }
+
+    bHanging = false;
+    SetClimbInputSign(0);
+    PendingSwingInput = FVector2D::ZeroVector;
+    ClearReleasePreview();
+
+    // Disable tick if rope no longer needs simulation.
+    if (!bRopeAttached)
+    {
+        SetSimulationActive(false);
+    }
+}
+
+bool UBPC_RopeTraversalComponent::CanContinueHanging(UCharacterMovementComponent& MoveComp)
+{
+    if (MoveComp.IsMovingOnGround() && MoveComp.CurrentFloor.bBlockingHit && MoveComp.CurrentFloor.HitResult.ImpactNormal.Z >= 0.85f)
+    {
+        ExitHanging();
+        RopeState = bRopeAttached ? ERopeState::Attached : ERopeState::Idle;
+        return false;
+    }
+
+    // Exit hanging if close enough to grounded surface to avoid falling animations.
+    if (GroundClimbProximity > 0.0f && MoveComp.CurrentFloor.bBlockingHit && MoveComp.CurrentFloor.FloorDist <= GroundClimbProximity)
+    {
+        ExitHanging();
+        RopeState = bRopeAttached ? ERopeState::Attached : ERopeState::Idle;
+        MoveComp.SetMovementMode(MOVE_Walking);
+        return false;
+    }
+
+    return true;
+}
+
+void UBPC_RopeTraversalComponent::ApplyHangingStep(UCharacterMovementComponent& MoveComp)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeApplyHanging);
+
+    // The core already advanced swing, climb, and the particle chain; push the result into the world.
+    ResolveRopeParticleCollisions();
+    MoveComp.Velocity = GetSimState().Velocity;
+
+    // Place character at the solved end particle with collision support.
+    const FVector TargetLocation = GetSimState().Location;
+    const FVector Delta = TargetLocation - StepActorLocation;
+
+    if (MoveComp.UpdatedComponent != nullptr)
+    {
+        FHitResult Hit;
+        MoveComp.SafeMoveUpdatedComponent(Delta, OwningCharacter->GetActorRotation(), true, Hit);
+    }
+    else
+    {
+        OwningCharacter->SetActorLocation(TargetLocation, false);
+    }
+
+    FinishHangingStep(MoveComp);
+}
+
+void UBPC_RopeTraversalComponent::FinishHangingStep(UCharacterMovementComponent& MoveComp)
+{
+    // Snap to walking as soon as ground contact occurs while climbing down.
+    if (MoveComp.CurrentFloor.bBlockingHit && MoveComp.CurrentFloor.HitResult.ImpactNormal.Z >= 0.85f)
+    {
+        ExitHanging();
+        RopeState = bRopeAttached ? ERopeState::Attached : ERopeState::Idle;
+        MoveComp.SetMovementMode(MOVE_Walking);
+    }
+}
+
+void UBPC_RopeTraversalComponent::ApplyTetherStep(UCharacterMovementComponent& MoveComp)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeApplyTether);
+
+    ResolveRopeParticleCollisions();
+
+    if (GetSimState().bBeyondLength)
+    {
+        OwningCharacter->SetActorLocation(GetSimState().Location, false);
+        MoveComp.Velocity = GetSimState().Velocity;
+    }
+
+    FinishTetherStep(MoveComp);
+}
+
+void UBPC_RopeTraversalComponent::FinishTetherStep(UCharacterMovementComponent& MoveComp)
+{
+    if (GetSimState().bTensioned && !MoveComp.IsMovingOnGround())
+    {
+        EnterHanging();
+    }
+}
+
+void UBPC_RopeTraversalComponent::EngageHoldConstraint()
+{
+    if (!OwningCharacter.IsValid() || !bRopeAttached)
+    {
+        return;
+    }
+
+    bHoldingRope = true;
+    RopeState = ERopeState::Attached;
+    WakeRope();
+    ResetRopeWrap();
+
+    const float Distance = FVector::Distance(OwningCharacter->GetActorLocation(), AnchorLocation);
+    GetSimState().RopeLength = FMath::Clamp(Distance, GetClimbMinLength(), MaxRopeLength);
+    InitializeRopeParticles();
+    ResetSimulationClock();
+
+    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+
+    if (MoveComp != nullptr && !MoveComp->IsMovingOnGround() && Distance >= GetSimState().RopeLength - 1.0f)
+    {
+        EnterHanging();
+        return;
+    }
+
+    SetSimulationActive(true);
+}
+
+bool UBPC_RopeTraversalComponent::CanProcessClimbInput() const
+{
+    // Climb input is only relevant while the rope is attached and the player is engaged with it.
+    return bRopeAttached && (bHanging || bHoldingRope);
+}
+
+float UBPC_RopeTraversalComponent::GetMinAnchorLength() const
+{
+    return FMath::Max(AnchorAssistDistance, 0.0f);
+}
+
+float UBPC_RopeTraversalComponent::GetDistanceToAnchor() const
+{
+    if (!OwningCharacter.IsValid())
+    {
+        return GetSimState().RopeLength;
+    }
+
+    // Measured along the rope, so a wrapped rope never counts as near the anchor.
+    return RopeWrappedLength + FVector::Distance(OwningCharacter->GetActorLocation(), GetSwingPivot());
+}
+
+void UBPC_RopeTraversalComponent::InitializeRopeParticles()
+{
+    if (!OwningCharacter.IsValid())
+    {
+        GetSimState().Particles.Reset();
+        return;
+    }
+
+    GetSimState().Particles.Initialize(GetSwingPivot(), OwningCharacter->GetActorLocation(), RopeParticleCount, GetFreeRopeLength(), RopeCharacterInverseMass);
+}
+
+FRopeSimParams UBPC_RopeTraversalComponent::MakeSimParams() const
+{
+    FRopeSimParams Params;
+    Params.MaxRopeLength = MaxRopeLength;
+    // Climbing stops short of the last wrap pivot so the free segment never collapses.
+    Params.ClimbMinLength = RopeWrapPivots.Num() > 0 ? FMath::Max(GetClimbMinLength(), RopeWrap::MinFreeLength) + RopeWrappedLength : GetClimbMinLength();
+    Params.SwingAcceleration = SwingAcceleration;
+    Params.SwingDamping = SwingDamping;
+    Params.ClimbSpeed = ClimbSpeed;
+    Params.ParticleCount = RopeParticleCount;
+    Params.SolverIterations = RopeSolverIterations;
+    Params.CharacterInverseMass = RopeCharacterInverseMass;
+    Params.bElastic = RopeStretchMode == ERopeStretchMode::Elastic;
+    Params.ElasticStiffness = ElasticStiffness;
+    Params.ElasticDamping = ElasticDamping;
+
+    switch (SwingIntegrator)
+    {
+    case ERopeSwingIntegrator::Rattle:
+        Params.SwingIntegrator = ERopeSimIntegrator::Rattle;
+        break;
+    case ERopeSwingIntegrator::RK4:
+        Params.SwingIntegrator = ERopeSimIntegrator::RK4;
+        break;
+    default:
+        Params.SwingIntegrator = ERopeSimIntegrator::Explicit;
+        break;
+    }
+
+    return Params;
+}
+
+FRopeSimInput UBPC_RopeTraversalComponent::MakeSimInput(const float DeltaTime, const UCharacterMovementComponent& MoveComp) const
+{
+    FRopeSimInput Input;
+    Input.DeltaTime = DeltaTime;
+    Input.AnchorLocation = GetSwingPivot();
+    Input.WrappedLength = RopeWrappedLength;
 
-    // Exit if nothing hit to preview.
-    if (!bHit)
+    if (OwningCharacter.IsValid())
     {
-        bHasPreview = false;
-        bPreviewWithinRange = false;
-        return;
+        Input.ActorLocation = OwningCharacter->GetActorLocation();
+        Input.ActorForward = OwningCharacter->GetActorForwardVector();
+        Input.ActorRight = OwningCharacter->GetActorRightVector();
     }
 
-    bHasPreview = true;
-    PreviewImpactPoint = HitResult.ImpactPoint;
-    PreviewImpactNormal = HitResult.ImpactNormal;
-    bPreviewWithinRange = FVector::Distance(OwningCharacter->GetActorLocation(), HitResult.ImpactPoint) <= MaxRopeLength;
+    Input.ActorVelocity = MoveComp.Velocity;
+    Input.Gravity = FVector(0.0f, 0.0f, MoveComp.GetGravityZ());
+    Input.SwingInput = PendingSwingInput;
+
+    // The rope movement component holds the capsule while hanging, so the core has to move it; plain falling moves it itself.
+    Input.bIntegrateActor = GetRopeMovement() != nullptr;
+    return Input;
 }
 
-void UBPC_RopeTraversalComponent::TickRopeFlight(const float DeltaTime)
+float UBPC_RopeTraversalComponent::GetSimulationStepSeconds() const
 {
-    RopeFlightElapsed += DeltaTime;
-    const float Alpha = RopeFlightDuration > KINDA_SMALL_NUMBER ? FMath::Clamp(RopeFlightElapsed / RopeFlightDuration, 0.0f, 1.0f) : 1.0f;
-    const FVector FlatPosition = FMath::Lerp(RopeFlightStart, RopeFlightTarget, Alpha);
-    const float Distance = FVector::Distance(RopeFlightStart, RopeFlightTarget);
-    const float ArcHeight = FMath::Clamp(Distance * 0.25f, 120.0f, 600.0f);
-    const float VerticalOffset = FMath::Sin(Alpha * PI) * ArcHeight;
-    AnchorLocation = FlatPosition + FVector::UpVector * VerticalOffset;
+    // The owning client predicts its rope at full rate; a slower server step would correct every move it sends.
+    const bool bClientPredicted = OwningCharacter.IsValid() && OwningCharacter->GetRemoteRole() == ROLE_AutonomousProxy;
+    const float RateScale = bClientPredicted ? 1.0f : GetSignificanceBudget().SimulationRateScale;
+    return 1.0f / FMath::Max(SimulationStepRate * RateScale, 1.0f);
+}
 
-    if (Alpha >= 1.0f - KINDA_SMALL_NUMBER)
-        CompleteRopeFlight();
+int32 UBPC_RopeTraversalComponent::ConsumeSimulationSteps(const float DeltaTime, float& InOutAccumulator) const
+{
+    const float StepSeconds = GetSimulationStepSeconds();
+    const int32 MaxSteps = FMath::Max(MaxSimulationSubsteps, 1);
+    InOutAccumulator += DeltaTime;
+
+    const int32 StepCount = FMath::Min(FMath::FloorToInt32(InOutAccumulator / StepSeconds), MaxSteps);
+    InOutAccumulator -= StepCount * StepSeconds;
+
+    // Drop backlog beyond the substep cap so a hitch frame never injects extra swing energy.
+    InOutAccumulator = FMath::Min(InOutAccumulator, StepSeconds);
+    return StepCount;
 }
 
-void UBPC_RopeTraversalComponent::CompleteRopeFlight()
+void UBPC_RopeTraversalComponent::ResetSimulationClock()
 {
-    RopeFlightElapsed = 0.0f;
-    RopeState = ERopeState::Attached;
-    AnchorLocation = RopeFlightTarget;
-    AnchorNormal = PreviewImpactNormal;
-    CurrentRopeLength = FMath::Clamp(FVector::Distance(OwningCharacter.IsValid() ? OwningCharacter->GetActorLocation() : RopeFlightStart, AnchorLocation), GetClimbMinLength(), MaxRopeLength);
-    bRopeAttached = true;
-    bHoldingRope = bPreviewWithinRange;
-    if (bHoldingRope)
-        EngageHoldConstraint();
-    else
-        SetComponentTickEnabled(false);
+    ++AsyncGeneration;
+    SimulationAccumulator = 0.0f;
+    PreviousStepPositions.Reset();
+    GetSimState().Particles.GetWorldPositions(RopeRenderPositions);
 }
 
-void UBPC_RopeTraversalComponent::EnterHanging()
+void UBPC_RopeTraversalComponent::UpdateRopeRenderPositions(const float Alpha)
 {
-    // Ensure owner is valid before changing movement.
-    if (!OwningCharacter.IsValid())
+    // Render positions live in world space; the solver's local frame moves with the anchor between steps.
+    GetSimState().Particles.GetWorldPositions(RopeRenderPositions);
+
+    // Without matching history (first step or rebuilt chain) render the latest state directly.
+    if (PreviousStepPositions.Num() != RopeRenderPositions.Num())
     {
         return;
     }
 
-    // Avoid duplicate transitions.
-    if (bHanging)
+    const float ClampedAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
+
+    for (int32 Index = 0; Index < RopeRenderPositions.Num(); ++Index)
     {
-        return;
+        RopeRenderPositions[Index] = FMath::Lerp(PreviousStepPositions[Index], RopeRenderPositions[Index], ClampedAlpha);
     }
+}
 
-    // Switch to falling while keeping gravity for natural rope tension.
-    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+void UBPC_RopeTraversalComponent::ResolveRopeParticleCollisions()
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeParticleCollision);
 
-    if (MoveComp == nullptr)
+    UWorld* const World = GetWorld();
+
+    if (World == nullptr || RopeCollisionRadius <= 0.0f || !GetSignificanceBudget().bContactSweeps || !GetSimState().Particles.IsInitialized())
     {
         return;
     }
 
-    SavedGravityScale = MoveComp->GravityScale;
-    MoveComp->SetMovementMode(MOVE_Falling);
-    MoveComp->GravityScale = SavedGravityScale;
-    const FVector AnchorToActor = OwningCharacter->GetActorLocation() - AnchorLocation;
-    const float Distance = AnchorToActor.Size();
-    if (Distance > KINDA_SMALL_NUMBER)
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeParticleSweep), false, GetOwner());
+    const FCollisionShape Shape = FCollisionShape::MakeSphere(RopeCollisionRadius);
+    FRopeParticleSolver& Particles = GetSimState().Particles;
+    const FVector& Origin = Particles.GetOrigin();
+    TArray<FVector3f>& Positions = Particles.GetMutableLocalPositions();
+    const TArray<FVector3f>& PreviousPositions = Particles.GetLocalPreviousPositions();
+
+    const FRopeCollisionField* const Field = bUseRopeCollisionField && RopeCollisionField.IsValid() ? RopeCollisionField.Get() : nullptr;
+    int32 FieldQueries = 0;
+    int32 SceneQueries = 0;
+
+    // Only interior particles collide; the anchor sits on its surface and the character has its own capsule.
+    // Static geometry comes from the field; sweeps run in world space and hits are written back relative to the anchor.
+    for (int32 Index = 1; Index + 1 < Positions.Num(); ++Index)
     {
-        const FVector RopeDir = AnchorToActor / Distance;
-        const float RadialSpeed = FVector::DotProduct(MoveComp->Velocity, RopeDir);
-        MoveComp->Velocity -= RopeDir * RadialSpeed;
+        const FVector SweepStart = Origin + FVector(PreviousPositions[Index]);
+        const FVector SweepEnd = Origin + FVector(Positions[Index]);
+        FVector FieldResolved;
+
+        if (Field != nullptr && ResolveParticleWithField(*Field, SweepEnd, SweepStart, FieldResolved))
+        {
+            ++FieldQueries;
+            Positions[Index] = FVector3f(FieldResolved - Origin);
+            continue;
+        }
+
+        ++SceneQueries;
+        FHitResult Hit;
+
+        if (!World->SweepSingleByChannel(Hit, SweepStart, SweepEnd, FQuat::Identity, ECC_Visibility, Shape, Params))
+        {
+            continue;
+        }
+
+        const FVector Resolved = Hit.bStartPenetrating ? SweepEnd + Hit.Normal * (Hit.PenetrationDepth + KINDA_SMALL_NUMBER) : Hit.Location;
+        Positions[Index] = FVector3f(Resolved - Origin);
     }
-    bHanging = true;
-    RopeState = ERopeState::Hanging;
-    SetComponentTickEnabled(true);
+
+    INC_DWORD_STAT_BY(STAT_RopeFieldQueries, FieldQueries);
+    INC_DWORD_STAT_BY(STAT_RopeParticleSceneQueries, SceneQueries);
 }
 
-void UBPC_RopeTraversalComponent::ExitHanging()
+bool UBPC_RopeTraversalComponent::ResolveParticleWithField(const FRopeCollisionField& Field, const FVector& Location, const FVector& PreviousLocation, FVector& OutResolved) const
 {
-    // Restore movement mode and gravity when leaving rope hang.
-    if (!OwningCharacter.IsValid())
+    // A step longer than half the band could skip a thin wall between samples; let the sweep catch it.
+    const float MaxStep = Field.GetBandWidth() * 0.5f;
+
+    if (FVector::DistSquared(Location, PreviousLocation) > FMath::Square(MaxStep) || !Field.CanResolve(Location, RopeCollisionRadius))
     {
-        return;
+        return false;
     }
 
-    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
-
-    if (MoveComp != nullptr)
+    for (const FBox& DynamicBox : RopeDynamicBoxes)
     {
-        MoveComp->GravityScale = SavedGravityScale;
-        MoveComp->SetMovementMode(MoveComp->IsMovingOnGround() ? MOVE_Walking : MOVE_Falling);
+        if (DynamicBox.ExpandBy(RopeCollisionRadius).IsInside(Location))
+        {
+            return false;
+        }
     }
 
-    bHanging = false;
-    ClimbInputSign = 0;
-    PendingSwingInput = FVector2D::ZeroVector;
+    FVector Normal;
+    const float Distance = Field.Sample(Location, Normal);
+    OutResolved = Location;
 
-    // Disable tick if rope no longer needs simulation.
-    if (!bRopeAttached)
+    if (Distance >= RopeCollisionRadius)
     {
-        SetComponentTickEnabled(false);
+        return true;
     }
-}
 
-void UBPC_RopeTraversalComponent::TickHanging(const float DeltaTime)
-{
-    // Abort and clear rope if owner is gone.
-    if (!OwningCharacter.IsValid())
+    // Deep inside a thick body the clamped samples carry no gradient; only a sweep from the previous position can push out.
+    if (Normal.IsNearlyZero())
     {
-        ClearRope();
-        return;
+        return false;
     }
 
-    // Require movement component for positional updates.
-    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+    OutResolved = Location + Normal * (RopeCollisionRadius - Distance);
+    return true;
+}
 
-    if (MoveComp == nullptr)
+void UBPC_RopeTraversalComponent::UpdateRopeCollisionField()
+{
+    RopeDynamicBoxes.Reset();
+    UWorld* const World = GetWorld();
+
+    if (!bUseRopeCollisionField || World == nullptr || RopeCollisionRadius <= 0.0f || !GetSignificanceBudget().bContactSweeps)
     {
-        ClearRope();
         return;
     }
 
-    if (MoveComp->IsMovingOnGround() && MoveComp->CurrentFloor.bBlockingHit && MoveComp->CurrentFloor.HitResult.ImpactNormal.Z >= 0.85f)
+    if (PendingRopeCollisionField.IsValid() && RopeCollisionFieldTask.IsCompleted())
     {
-        ExitHanging();
-        RopeState = bRopeAttached ? ERopeState::Attached : ERopeState::Idle;
-        return;
+        if (PendingRopeCollisionField->IsBuilt())
+        {
+            RopeCollisionField = MoveTemp(PendingRopeCollisionField);
+        }
+
+        PendingRopeCollisionField.Reset();
     }
 
-    const FVector ActorLocation = OwningCharacter->GetActorLocation();
-    FVector RopeVector = ActorLocation - AnchorLocation;
-    const float Distance = RopeVector.Size();
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeCollisionField), false, GetOwner());
+
+    // Every particle stays within rope length of the anchor, wrapped or not, so this box bounds the whole swing.
+    const float ReachExtent = GetSimState().RopeLength + RopeCollisionRadius;
+    const FBox SwingVolume = FBox::BuildAABB(AnchorLocation, FVector(ReachExtent));
+    const bool bFieldCovers = RopeCollisionField.IsValid() && RopeCollisionField->GetRegion().IsInside(SwingVolume);
+
+    // Static geometry is captured here and sampled on a worker; one build is in flight at a time, and a rope that
+    // outgrows it starts the next one once it lands.
+    // A region too large for the brick table is latched, so the rope keeps its per-particle sweeps without regathering.
+    const bool bKnownTooLarge = bRopeCollisionFieldFailed && FailedFieldAnchor.Equals(AnchorLocation) && ReachExtent >= FailedFieldReach && FailedFieldVoxelSize == RopeCollisionVoxelSize;
+
+    if (!bFieldCovers && !bKnownTooLarge && !PendingRopeCollisionField.IsValid())
+    {
+        const float BandWidth = RopeCollisionVoxelSize * RopeCollision::BandCells;
+        const FBox Region = FBox::BuildAABB(AnchorLocation, FVector(ReachExtent * RopeCollision::RegionSlack + BandWidth));
+
+        if (!FRopeCollisionField::FitsBrickTable(Region, RopeCollisionVoxelSize))
+        {
+            if (!bRopeCollisionFieldFailed)
+            {
+                UE_LOG(LogRopePrototype, Warning, TEXT("Rope collision field skipped for %s: a %.0f cm reach at %.1f cm voxels exceeds the brick table; raise RopeCollisionVoxelSize. Using scene queries."), *GetNameSafe(GetOwner()), ReachExtent, RopeCollisionVoxelSize);
+            }
+
+            bRopeCollisionFieldFailed = true;
+            FailedFieldAnchor = AnchorLocation;
+            FailedFieldReach = ReachExtent;
+            FailedFieldVoxelSize = RopeCollisionVoxelSize;
+        }
+        else
+        {
+            TArray<FRopeFieldPrimitive> Primitives;
+            TArray<FBox> FallbackBoxes;
+            FRopeCollisionField::GatherStaticPrimitives(*World, Region, ECC_Visibility, Params, Primitives, FallbackBoxes);
+
+            PendingRopeCollisionField = MakeShared<FRopeCollisionField, ESPMode::ThreadSafe>();
+            RopeCollisionFieldTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+                [Field = PendingRopeCollisionField, Region, VoxelSize = RopeCollisionVoxelSize, BandWidth, Primitives = MoveTemp(Primitives), FallbackBoxes = MoveTemp(FallbackBoxes)]() mutable
+                {
+                    Field->Build(Region, VoxelSize, BandWidth, Primitives, MoveTemp(FallbackBoxes));
+                });
+        }
+    }
 
-    // Avoid division by zero when extremely close.
-    if (Distance <= KINDA_SMALL_NUMBER)
+    if (!GetSimState().Particles.IsInitialized())
     {
         return;
     }
 
-    // Exit hanging if close enough to grounded surface to avoid falling animations.
-    if (GroundClimbProximity > 0.0f && MoveComp->CurrentFloor.bBlockingHit && MoveComp->CurrentFloor.FloorDist <= GroundClimbProximity)
+    // One overlap per frame finds movable bodies the field cannot hold; with none around, no particle sweeps at all.
+    TArray<FVector> ParticlePositions;
+    GetSimState().Particles.GetWorldPositions(ParticlePositions);
+    const FBox RopeBounds = FBox(ParticlePositions).ExpandBy(RopeCollisionRadius + RopeCollision::DynamicMargin);
+    TArray<FOverlapResult> Overlaps;
+    World->OverlapMultiByObjectType(Overlaps, RopeBounds.GetCenter(), FQuat::Identity, FCollisionObjectQueryParams(FCollisionObjectQueryParams::AllDynamicObjects), FCollisionShape::MakeBox(RopeBounds.GetExtent()), Params);
+
+    for (const FOverlapResult& Overlap : Overlaps)
     {
-        ExitHanging();
-        RopeState = bRopeAttached ? ERopeState::Attached : ERopeState::Idle;
+        const UPrimitiveComponent* const Component = Overlap.GetComponent();
 
-        if (UCharacterMovementComponent* const PostMoveComp = OwningCharacter->GetCharacterMovement())
+        if (Component != nullptr && Component->Mobility == EComponentMobility::Movable && Component->GetCollisionResponseToChannel(ECC_Visibility) == ECR_Block)
         {
-            PostMoveComp->SetMovementMode(MOVE_Walking);
+            RopeDynamicBoxes.Add(Component->Bounds.GetBox());
         }
+    }
+}
+
+void UBPC_RopeTraversalComponent::UpdateRopeWrap()
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeWrapUpdate);
 
+    if (!bEnableRopeWrapping || !OwningCharacter.IsValid())
+    {
         return;
     }
 
-    // Update current rope length based on climb input.
-    ApplyClimbLengthChange(DeltaTime);
+    const FVector EndLocation = OwningCharacter->GetActorLocation();
+    bool bWrapChanged = false;
 
-    const FVector RopeDir = RopeVector / Distance;
-    // Build tangential acceleration from cached swing input relative to rope.
-    FVector TangentAccel = OwningCharacter->GetActorForwardVector() * PendingSwingInput.Y + OwningCharacter->GetActorRightVector() * PendingSwingInput.X;
-    TangentAccel = TangentAccel - FVector::DotProduct(TangentAccel, RopeDir) * RopeDir;
+    // Unwind newest first: a pivot pops once the bend at it reverses.
+    while (RopeWrapPivots.Num() > 0)
+    {
+        const int32 Top = RopeWrapPivots.Num() - 1;
+        const FVector PreviousPoint = Top > 0 ? RopeWrapPivots[Top - 1].Location : AnchorLocation;
 
-    const FVector Gravity = FVector(0.0f, 0.0f, GetWorld()->GetGravityZ() * MoveComp->GravityScale);
-    const FVector TangentGravity = Gravity - FVector::DotProduct(Gravity, RopeDir) * RopeDir;
+        if (!FRopeSimCore::IsWrapReversed(PreviousPoint, RopeWrapPivots[Top].Location, RopeWrapPivots[Top].BendAxis, EndLocation))
+        {
+            break;
+        }
 
-    // Apply tangential swing input and gravity while keeping rope length.
-    MoveComp->Velocity += (TangentAccel * SwingAcceleration + TangentGravity) * DeltaTime;
-    const float RadialSpeed = FVector::DotProduct(MoveComp->Velocity, RopeDir);
-    MoveComp->Velocity -= RopeDir * RadialSpeed;
+        RopeWrapPivots.Pop(EAllowShrinking::No);
+        bWrapChanged = true;
+    }
 
-    const float DampingScale = PendingSwingInput.IsNearlyZero() ? SwingDamping * 2.0f : SwingDamping;
-    MoveComp->Velocity *= FMath::Clamp(1.0f - DampingScale * DeltaTime, 0.0f, 1.0f);
+    // Only the free segment is traced; rope laid along earlier pivots is never queried again.
+    if (RopeWrapPivots.Num() < MaxRopeWrapPivots && TryPushRopeWrapPivot(GetSwingPivot(), EndLocation))
+    {
+        bWrapChanged = true;
+    }
 
-    // Place character at constrained position along rope with collision support.
-    const FVector TargetLocation = AnchorLocation + RopeDir * CurrentRopeLength;
-    const FVector Delta = TargetLocation - ActorLocation;
+    LastWrapEndLocation = EndLocation;
 
-    if (MoveComp->UpdatedComponent != nullptr)
+    if (bWrapChanged)
     {
-        FHitResult Hit;
-        MoveComp->SafeMoveUpdatedComponent(Delta, OwningCharacter->GetActorRotation(), true, Hit);
+        RebuildRopeAfterWrap();
     }
-    else
+}
+
+bool UBPC_RopeTraversalComponent::TryPushRopeWrapPivot(const FVector& SwingPivot, const FVector& EndLocation)
+{
+    UWorld* const World = GetWorld();
+
+    if (World == nullptr)
     {
-        OwningCharacter->SetActorLocation(TargetLocation, false);
+        return false;
     }
 
-    // Snap to walking as soon as ground contact occurs while climbing down.
-    if (MoveComp->CurrentFloor.bBlockingHit && MoveComp->CurrentFloor.HitResult.ImpactNormal.Z >= 0.85f)
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeWrapTrace), false, GetOwner());
+    FHitResult Hit;
+
+    const bool bPreviousSegmentClear = bLastWrapSegmentClear;
+    bLastWrapSegmentClear = !World->LineTraceSingleByChannel(Hit, SwingPivot, EndLocation, ECC_Visibility, Params) || Hit.bStartPenetrating;
+
+    if (bLastWrapSegmentClear)
     {
-        ExitHanging();
-        RopeState = bRopeAttached ? ERopeState::Attached : ERopeState::Idle;
+        return false;
+    }
 
-        if (UCharacterMovementComponent* const PostMoveComp = OwningCharacter->GetCharacterMovement())
+    // Bisect toward last frame's end only when that segment was clear; a contact rejected last frame keeps its
+    // direct hit, so a rope brushing a wall costs one trace per frame.
+    FVector ClearEnd = LastWrapEndLocation;
+    FVector BlockedEnd = EndLocation;
+
+    for (int32 Iteration = 0; bPreviousSegmentClear && Iteration < RopeWrap::CornerRefineIterations; ++Iteration)
+    {
+        const FVector MidEnd = (ClearEnd + BlockedEnd) * 0.5;
+        FHitResult MidHit;
+
+        if (World->LineTraceSingleByChannel(MidHit, SwingPivot, MidEnd, ECC_Visibility, Params) && !MidHit.bStartPenetrating)
+        {
+            BlockedEnd = MidEnd;
+            Hit = MidHit;
+        }
+        else
         {
-            PostMoveComp->SetMovementMode(MOVE_Walking);
+            ClearEnd = MidEnd;
         }
+    }
 
-        return;
+    const FVector PivotLocation = Hit.ImpactPoint + Hit.ImpactNormal * RopeWrapOffset;
+    const float PivotDistance = FVector::Distance(SwingPivot, PivotLocation);
+
+    // Ignore contacts hugging either end, such as the character brushing a wall.
+    if (PivotDistance < RopeWrap::MinPivotSpacing || FVector::Distance(PivotLocation, EndLocation) < RopeWrap::MinPivotSpacing)
+    {
+        return false;
     }
 
-    // Clear swing input after applying.
-    PendingSwingInput = FVector2D::ZeroVector;
-}
+    // Keep enough free rope for the particle chain to swing.
+    if (GetSimState().RopeLength - (RopeWrappedLength + PivotDistance) < RopeWrap::MinFreeLength)
+    {
+        return false;
+    }
 
-void UBPC_RopeTraversalComponent::TickTether(const float DeltaTime)
-{
-    if (!OwningCharacter.IsValid())
+    const FVector BendAxis = FRopeSimCore::ComputeWrapBendAxis(SwingPivot, PivotLocation, EndLocation);
+
+    if (BendAxis.IsZero())
     {
-        ClearRope();
-        return;
+        return false;
     }
 
-    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+    FRopeWrapPivot& Pivot = RopeWrapPivots.AddDefaulted_GetRef();
+    Pivot.Location = PivotLocation;
+    Pivot.BendAxis = BendAxis;
 
-    if (MoveComp == nullptr)
+    // The new free segment starts off the corner, so the next contact bisects again.
+    bLastWrapSegmentClear = true;
+
+    if (bDebugRopeAssist)
     {
-        ClearRope();
-        return;
+        DrawDebugSphere(World, PivotLocation, RopeWrapOffset + 4.0f, 8, FColor::Magenta, false, 1.0f, 0, 1.5f);
     }
 
-    CurrentRopeLength = FMath::Clamp(CurrentRopeLength, GetClimbMinLength(), MaxRopeLength);
+    return true;
+}
+
+void UBPC_RopeTraversalComponent::ResetRopeWrap()
+{
+    LastWrapEndLocation = OwningCharacter.IsValid() ? OwningCharacter->GetActorLocation() : AnchorLocation;
+    bLastWrapSegmentClear = true;
+    RopeWrapPivots.Reset();
+    RopeWrappedLength = 0.0f;
+}
 
-    const FVector ActorLocation = OwningCharacter->GetActorLocation();
-    const FVector RopeVector = ActorLocation - AnchorLocation;
-    const float Distance = RopeVector.Size();
+void UBPC_RopeTraversalComponent::RebuildRopeAfterWrap()
+{
+    RopeWrappedLength = 0.0f;
+    FVector PreviousPoint = AnchorLocation;
 
-    if (Distance <= KINDA_SMALL_NUMBER)
+    for (const FRopeWrapPivot& Pivot : RopeWrapPivots)
     {
-        return;
+        RopeWrappedLength += FVector::Distance(PreviousPoint, Pivot.Location);
+        PreviousPoint = Pivot.Location;
     }
 
-    const FVector RopeDir = RopeVector / Distance;
-    const bool bBeyondLength = Distance > CurrentRopeLength;
+    // The chain now spans a different segment; rebuild it here and on the physics thread.
+    InitializeRopeParticles();
+    ++AsyncGeneration;
+    PreviousStepPositions.Reset();
+    UpdateRopeRenderPositions(1.0f);
+}
+
+float UBPC_RopeTraversalComponent::GetFreeRopeLength() const
+{
+    return FMath::Max(GetSimState().RopeLength - RopeWrappedLength, 0.0f);
+}
+
+bool UBPC_RopeTraversalComponent::UpdateRopeSleep()
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeSleepUpdate);
+
+    UCharacterMovementComponent* const MoveComp = OwningCharacter.IsValid() ? OwningCharacter->GetCharacterMovement() : nullptr;
 
-    if (bBeyondLength)
+    if (!bAllowRopeSleep || MoveComp == nullptr)
     {
-        const FVector TargetLocation = AnchorLocation + RopeDir * CurrentRopeLength;
-        OwningCharacter->SetActorLocation(TargetLocation, false);
-        const FVector OutwardVelocity = FVector::DotProduct(MoveComp->Velocity, RopeDir) * RopeDir;
-        const float DampingAlpha = FMath::Clamp(1.0f - SwingDamping * DeltaTime, 0.0f, 1.0f);
-        MoveComp->Velocity = (MoveComp->Velocity - OutwardVelocity) * DampingAlpha;
+        WakeRope();
+        return false;
+    }
+
+    if (bRopeAsleep)
+    {
+        // Anything that could move the rope wakes it: input, a mode change, or an outside push.
+        const bool bDisturbed = HasRopeInput(*MoveComp)
+            || MoveComp->MovementMode != SleepMovementMode
+            || MoveComp->CustomMovementMode != SleepCustomMovementMode
+            || GetRopeSleepSpeed(*MoveComp) > SleepSpeedThreshold
+            || FVector::DistSquared(OwningCharacter->GetActorLocation(), SleepLocation) > FMath::Square(SleepWakeDistance);
+
+        if (!bDisturbed)
+        {
+            return true;
+        }
+
+        WakeRope();
+        return false;
     }
 
-    const float EffectiveDistance = bBeyondLength ? CurrentRopeLength : Distance;
-    const bool bTensioned = EffectiveDistance >= CurrentRopeLength - 1.5f;
+    const float RopeLength = GetSimState().RopeLength;
+    const bool bQuiet = !HasRopeInput(*MoveComp)
+        && GetRopeSleepSpeed(*MoveComp) <= SleepSpeedThreshold
+        && FMath::Abs(RopeLength - SleepCheckRopeLength) <= SleepLengthThreshold;
 
-    if (bTensioned && !MoveComp->IsMovingOnGround())
+    SleepCheckRopeLength = RopeLength;
+    RopeQuietFrames = bQuiet ? RopeQuietFrames + 1 : 0;
+
+    if (RopeQuietFrames < SleepFramesRequired)
     {
-        EnterHanging();
+        return false;
     }
+
+    PutRopeToSleep(*MoveComp);
+    return true;
 }
 
-void UBPC_RopeTraversalComponent::EngageHoldConstraint()
+void UBPC_RopeTraversalComponent::PushRopeInputSample(const FVector2f& SwingInput, const int8 ClimbSign)
 {
-    if (!OwningCharacter.IsValid() || !bRopeAttached)
+    // Triggered callbacks repeat every frame while held; only changes carry timing.
+    if (SwingInput == LatestRopeInput.SwingInput && ClimbSign == LatestRopeInput.ClimbSign)
     {
         return;
     }
 
-    bHoldingRope = true;
-    RopeState = ERopeState::Attached;
-
-    const float Distance = FVector::Distance(OwningCharacter->GetActorLocation(), AnchorLocation);
-    CurrentRopeLength = FMath::Clamp(Distance, GetClimbMinLength(), MaxRopeLength);
-
-    UCharacterMovementComponent* const MoveComp = OwningCharacter->GetCharacterMovement();
+    LatestRopeInput.Time = FPlatformTime::Seconds();
+    LatestRopeInput.SwingInput = SwingInput;
+    LatestRopeInput.ClimbSign = ClimbSign;
 
-    if (MoveComp != nullptr && !MoveComp->IsMovingOnGround() && Distance >= CurrentRopeLength - 1.0f)
+    // Nothing consumes input without an attached rope; hold the latest value so the first window after attaching starts from it.
+    if (!bRopeAttached)
     {
-        EnterHanging();
+        RopeInputBuffer.Reset(LatestRopeInput);
         return;
     }
 
-    SetComponentTickEnabled(true);
+    if (!RopeInputBuffer.Push(LatestRopeInput))
+    {
+        bRopeInputDropped = true;
+    }
 }
 
-bool UBPC_RopeTraversalComponent::CanProcessClimbInput() const
+bool UBPC_RopeTraversalComponent::UsesSubframeInput() const
 {
-    // Climb input is only relevant while the rope is attached and the player is engaged with it.
-    return bRopeAttached && (bHanging || bHoldingRope);
+    // Windowed swing and tap input never reach saved moves, so only a player with no remote authority to disagree
+    // with (standalone or the listen-server host) may use it; networked clients keep the replicated per-move input.
+    return bUseSubframeInput && OwningCharacter.IsValid() && OwningCharacter->IsLocallyControlled() && OwningCharacter->IsPlayerControlled() && OwningCharacter->HasAuthority();
 }
 
-float UBPC_RopeTraversalComponent::GetMinAnchorLength() const
+void UBPC_RopeTraversalComponent::DrainRopeInput()
 {
-    return FMath::Max(AnchorAssistDistance, 0.0f);
-}
+    const double Now = FPlatformTime::Seconds();
 
-float UBPC_RopeTraversalComponent::GetDistanceToAnchor() const
-{
-    if (!OwningCharacter.IsValid())
+    if (bRopeInputDropped)
     {
-        return CurrentRopeLength;
+        FRopeInputSample Latest = LatestRopeInput;
+        Latest.Time = Now;
+        RopeInputBuffer.Reset(Latest);
+        bRopeInputDropped = false;
+        return;
     }
 
-    return FVector::Distance(OwningCharacter->GetActorLocation(), AnchorLocation);
+    RopeInputBuffer.ConsumeUntil(Now);
 }
 
-float UBPC_RopeTraversalComponent::GetClimbMinLength() const
+bool UBPC_RopeTraversalComponent::HasRopeInput(const UCharacterMovementComponent& MoveComp) const
 {
-    // Climb clamp dedicated to climbing; keep at zero to always reach the anchor.
-    return FMath::Max(ClimbMinLength, 0.0f);
+    return !PendingSwingInput.IsNearlyZero()
+        || GetSimState().ClimbInputSign != 0
+        || !MoveComp.GetCurrentAcceleration().IsNearlyZero();
 }
 
-void UBPC_RopeTraversalComponent::ApplyClimbLengthChange(const float DeltaTime)
+float UBPC_RopeTraversalComponent::GetRopeSleepSpeed(const UCharacterMovementComponent& MoveComp) const
 {
-    if (!CanProcessClimbInput() || ClimbInputSign == 0)
+    // A hanging character keeps a small radial velocity into the taut rope that never integrates into motion.
+    if (bHanging)
     {
-        return;
+        return FRopeSimCore::RemoveRadialVelocity(GetSwingPivot(), OwningCharacter->GetActorLocation(), MoveComp.Velocity).Size();
     }
 
-    const bool bClimbingDown = ClimbInputSign < 0;
-    const bool bAtMaxExtension = CurrentRopeLength >= MaxRopeLength - 0.5f;
+    return MoveComp.Velocity.Size();
+}
+
+void UBPC_RopeTraversalComponent::PutRopeToSleep(UCharacterMovementComponent& MoveComp)
+{
+    bRopeAsleep = true;
+    RopeQuietFrames = 0;
+    SleepLocation = OwningCharacter->GetActorLocation();
+    SleepMovementMode = MoveComp.MovementMode;
+    SleepCustomMovementMode = MoveComp.CustomMovementMode;
 
-    if (bClimbingDown && bAtMaxExtension)
+    // Without steps nothing resists gravity; hold a hanging character where it came to rest.
+    if (bHanging)
     {
-        ClimbInputSign = 0;
-        CurrentRopeLength = MaxRopeLength;
-        return;
+        MoveComp.Velocity = FVector::ZeroVector;
+        MoveComp.GravityScale = 0.0f;
     }
 
-    const float TargetLength = CurrentRopeLength - ClimbInputSign * ClimbSpeed * DeltaTime;
-    CurrentRopeLength = FMath::Clamp(TargetLength, GetClimbMinLength(), MaxRopeLength);
+    // Settle the visual chain once; it stays frozen until the rope wakes.
+    ResetSimulationClock();
+}
 
-    if (bClimbingDown && CurrentRopeLength >= MaxRopeLength - 0.5f)
-    {
-        CurrentRopeLength = MaxRopeLength;
-        ClimbInputSign = 0;
-    }
+float UBPC_RopeTraversalComponent::GetClimbMinLength() const
+{
+    // Climb clamp dedicated to climbing; keep at zero to always reach the anchor.
+    return FMath::Max(ClimbMinLength, 0.0f);
 }
 
 bool UBPC_RopeTraversalComponent::TryClimbToLedge()
@@ -890,7 +2783,7 @@ bool UBPC_RopeTraversalComponent::TryClimbToLedge()
     }
 
     const float AnchorDistance = GetDistanceToAnchor();
-    const float EffectiveDistance = FMath::Min(CurrentRopeLength, AnchorDistance);
+    const float EffectiveDistance = FMath::Min(GetSimState().RopeLength, AnchorDistance);
     const bool bNearAnchor = EffectiveDistance <= GetMinAnchorLength() + 8.0f;
 
     if (!bNearAnchor)
@@ -915,55 +2808,48 @@ bool UBPC_RopeTraversalComponent::TryClimbToLedge()
         }
     }
 
-    // Sweep upward near anchor normal to find a landing ledge.
-    const FVector ProbeStart = AnchorLocation + AnchorNormal * LedgeProbeRadius + FVector::UpVector * 20.0f;
-    const FVector ProbeEnd = ProbeStart - FVector::UpVector * 200.0f;
-
-    FHitResult HitResult;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(OwningCharacter.Get());
-
-    if (bDebugRopeAssist)
-    {
-        DrawDebugSphere(World, ProbeStart, LedgeProbeRadius, 16, FColor::Orange, false, 1.0f, 0, 2.0f);
-        DrawDebugLine(World, ProbeStart, ProbeEnd, FColor::Orange, false, 1.0f, 0, 1.5f);
-    }
-
-    const bool bHit = World->SweepSingleByChannel(HitResult, ProbeStart, ProbeEnd, FQuat::Identity, ECC_Visibility, FCollisionShape::MakeSphere(LedgeProbeRadius), Params);
-
     const float CapsuleHalfHeight = OwningCharacter->GetSimpleCollisionHalfHeight();
     const FVector FallbackTarget = AnchorLocation + FVector::UpVector * CapsuleHalfHeight;
     FVector TargetLocation = FallbackTarget;
 
-    if (bHit)
-    {
-    const float NormalDot = FVector::DotProduct(HitResult.ImpactNormal, AnchorNormal);
-    const bool bUpwardNormal = HitResult.ImpactNormal.Z >= 0.55f;
-    const bool bValidNormal = NormalDot >= LedgeNormalDotThreshold || bUpwardNormal;
+    // Baked ledges streamed in with their cell replace the probe sweep.
+    const URopeAnchorRegistrySubsystem* const AnchorRegistry = World->GetSubsystem<URopeAnchorRegistrySubsystem>();
+    FVector LedgeStandLocation = FVector::ZeroVector;
 
-    if (bValidNormal)
+    if (AnchorRegistry != nullptr && AnchorRegistry->FindBakedLedge(AnchorLocation, AnchorNormal, LedgeProbeRadius, LedgeNormalDotThreshold, LedgeStandLocation))
+    {
+        TargetLocation = LedgeStandLocation + FVector::UpVector * (CapsuleHalfHeight + LedgeVerticalOffset);
+    }
+    else
     {
-        const float StandOff = FMath::Max(LedgeStandOffDistance, 0.0f);
-        const float VerticalOffset = LedgeVerticalOffset;
-        FVector PlanarNormal = AnchorNormal;
-        PlanarNormal.Z = 0.0f;
+        // Sweep upward near anchor normal to find a landing ledge.
+        FVector ProbeStart = FVector::ZeroVector;
+        FVector ProbeEnd = FVector::ZeroVector;
+        FRopeSimCore::GetLedgeProbe(AnchorLocation, AnchorNormal, LedgeProbeRadius, ProbeStart, ProbeEnd);
 
-        if (PlanarNormal.IsNearlyZero())
+        FHitResult HitResult;
+        FCollisionQueryParams Params;
+        Params.AddIgnoredActor(OwningCharacter.Get());
+
+        if (bDebugRopeAssist)
         {
-            PlanarNormal = OwningCharacter->GetActorForwardVector();
-            PlanarNormal.Z = 0.0f;
+            DrawDebugSphere(World, ProbeStart, LedgeProbeRadius, 16, FColor::Orange, false, 1.0f, 0, 2.0f);
+            DrawDebugLine(World, ProbeStart, ProbeEnd, FColor::Orange, false, 1.0f, 0, 1.5f);
         }
 
-        PlanarNormal = PlanarNormal.GetSafeNormal();
-        const FVector PlanarOffset = -PlanarNormal * StandOff;
-        TargetLocation = HitResult.ImpactPoint + FVector::UpVector * (CapsuleHalfHeight + VerticalOffset) + PlanarOffset;
+        const bool bHit = World->SweepSingleByChannel(HitResult, ProbeStart, ProbeEnd, FQuat::Identity, ECC_Visibility, FCollisionShape::MakeSphere(LedgeProbeRadius), Params);
 
-        if (bDebugRopeAssist)
+        if (bHit && FRopeSimCore::IsValidLedgeNormal(HitResult.ImpactNormal, AnchorNormal, LedgeNormalDotThreshold))
         {
-            DrawDebugDirectionalArrow(World, HitResult.ImpactPoint, HitResult.ImpactPoint + HitResult.ImpactNormal * 80.0f, 24.0f, FColor::Blue, false, 1.0f, 0, 2.0f);
+            LedgeStandLocation = FRopeSimCore::GetLedgeStandLocation(HitResult.ImpactPoint, AnchorNormal, OwningCharacter->GetActorForwardVector(), LedgeStandOffDistance);
+            TargetLocation = LedgeStandLocation + FVector::UpVector * (CapsuleHalfHeight + LedgeVerticalOffset);
+
+            if (bDebugRopeAssist)
+            {
+                DrawDebugDirectionalArrow(World, HitResult.ImpactPoint, HitResult.ImpactPoint + HitResult.ImpactNormal * 80.0f, 24.0f, FColor::Blue, false, 1.0f, 0, 2.0f);
+            }
         }
     }
-    }
 
     const float AssistAlpha = FMath::Clamp(LedgeAssistStrength, 0.0f, 1.0f);
     TargetLocation = FMath::Lerp(OwningCharacter->GetActorLocation(), TargetLocation, AssistAlpha);
@@ -1012,14 +2898,19 @@ bool UBPC_RopeTraversalComponent::TryClimbToLedge()
     ExitHanging();
     RopeState = ERopeState::Attached;
     bHoldingRope = true;
-    CurrentRopeLength = FMath::Clamp(GetDistanceToAnchor(), GetClimbMinLength(), MaxRopeLength);
-    SetComponentTickEnabled(true);
+    ResetRopeWrap();
+    GetSimState().RopeLength = FMath::Clamp(GetDistanceToAnchor(), GetClimbMinLength(), MaxRopeLength);
+    ++AsyncGeneration;
+    SetSimulationActive(true);
 
     return true;
 }
 
 void UBPC_RopeTraversalComponent::ClearRope()
 {
+    // Wake first so a sleeping hang gets its gravity back before the flags are cleared.
+    WakeRope();
+
     // Reset all runtime rope flags and timers.
     bRopeAttached = false;
     bHoldingRope = false;
@@ -1027,18 +2918,28 @@ void UBPC_RopeTraversalComponent::ClearRope()
     bAimPreviewWhileAttached = false;
     RopeState = ERopeState::Idle;
     RecallAccumulated = 0.0f;
-    ClimbInputSign = 0;
+    SetClimbInputSign(0);
     PendingSwingInput = FVector2D::ZeroVector;
     bHasPreview = false;
     bPreviewWithinRange = false;
     PreviewImpactPoint = FVector::ZeroVector;
     PreviewImpactNormal = FVector::ZeroVector;
+    PreviewImpactComponent.Reset();
+    PreviewImpactBoneName = NAME_None;
+    BindAnchorComponent(nullptr, NAME_None, FVector::ZeroVector, FVector::ZeroVector);
     RopeFlightElapsed = 0.0f;
     RopeFlightDuration = 0.0f;
     RopeFlightStart = FVector::ZeroVector;
     RopeFlightTarget = FVector::ZeroVector;
-    CurrentRopeLength = MaxRopeLength;
-    SetComponentTickEnabled(false);
+    RopeFlightSweptSegments = 0;
+    bRopeFlightBlocked = false;
+    RopeFlightBlockAlpha = 1.0f;
+    GetSimState().RopeLength = MaxRopeLength;
+    GetSimState().Particles.Reset();
+    ResetRopeWrap();
+    ClearReleasePreview();
+    ResetSimulationClock();
+    SetSimulationActive(false);
 }
 #pragma endregion Helpers
 #pragma endregion Methods
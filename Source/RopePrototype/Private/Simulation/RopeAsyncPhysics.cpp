@@ -0,0 +1,90 @@
+// Summary: Implements the physics-thread rope callback.
+#include "Simulation/RopeAsyncPhysics.h"
+
+#include "RopePrototype.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Async Physics Step"), STAT_RopeAsyncPhysicsStep, STATGROUP_Rope);
+
+#pragma region Methods
+void FRopeAsyncInput::Reset()
+{
+    Serial = 0;
+    Ropes.Reset();
+    RemovedRopeIds.Reset();
+}
+
+void FRopeAsyncOutput::Reset()
+{
+    Ropes.Reset();
+}
+
+void FRopeAsyncSimCallback::OnPreSimulate_Internal()
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeAsyncPhysicsStep);
+
+    const FRopeAsyncInput* const AsyncInput = GetConsumerInput_Internal();
+
+    if (AsyncInput == nullptr)
+    {
+        return;
+    }
+
+    // Physics may step several times per game frame; only the first step sees the game-thread actor pose.
+    const bool bFreshInput = AsyncInput->Serial != LastConsumedSerial;
+    LastConsumedSerial = AsyncInput->Serial;
+
+    for (const int32 RopeId : AsyncInput->RemovedRopeIds)
+    {
+        States.Remove(RopeId);
+        Generations.Remove(RopeId);
+    }
+
+    FRopeAsyncOutput& AsyncOutput = GetProducerOutputData_Internal();
+    AsyncOutput.Ropes.Reset(AsyncInput->Ropes.Num());
+    const float DeltaTime = GetDeltaTime_Internal();
+
+    for (const FRopeAsyncRopeInput& RopeInput : AsyncInput->Ropes)
+    {
+        FRopeSimState& State = States.FindOrAdd(RopeInput.RopeId);
+        int32& Generation = Generations.FindOrAdd(RopeInput.RopeId, INDEX_NONE);
+
+        if (Generation != RopeInput.Generation)
+        {
+            State = FRopeSimState();
+            State.RopeLength = RopeInput.RopeLength;
+            State.Location = RopeInput.Input.ActorLocation;
+            State.Velocity = RopeInput.Input.ActorVelocity;
+            Generation = RopeInput.Generation;
+        }
+
+        FRopeSimInput StepInput = RopeInput.Input;
+        StepInput.DeltaTime = DeltaTime;
+
+        if (!bFreshInput)
+        {
+            StepInput.ActorLocation = State.Location;
+            StepInput.ActorVelocity = State.Velocity;
+            StepInput.ClimbTapSign = 0;
+        }
+
+        State.ClimbInputSign = RopeInput.ClimbInputSign;
+        FRopeSimCore::Step(RopeInput.Kind, RopeInput.Params, StepInput, State);
+
+        FRopeAsyncRopeOutput& RopeOutput = AsyncOutput.Ropes.AddDefaulted_GetRef();
+        RopeOutput.RopeId = RopeInput.RopeId;
+        RopeOutput.Generation = Generation;
+        RopeOutput.Kind = RopeInput.Kind;
+        RopeOutput.RopeLength = State.RopeLength;
+        RopeOutput.ClimbInputSign = State.ClimbInputSign;
+        RopeOutput.Location = State.Location;
+        RopeOutput.Velocity = State.Velocity;
+        RopeOutput.bTensioned = State.bTensioned;
+        RopeOutput.bBeyondLength = State.bBeyondLength;
+        RopeOutput.Tension = State.Tension;
+        RopeOutput.ConstraintImpulse = State.ConstraintImpulse;
+        RopeOutput.Origin = State.Particles.GetOrigin();
+        RopeOutput.Positions = State.Particles.GetLocalPositions();
+        RopeOutput.SegmentTensions = State.Particles.GetSegmentTensions();
+    }
+}
+#pragma endregion Methods
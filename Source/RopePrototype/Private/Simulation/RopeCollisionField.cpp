@@ -0,0 +1,490 @@
+// Summary: Implements the sparse rope collision field: static geometry capture, brick build, and constant-time sampling.
+#include "Simulation/RopeCollisionField.h"
+
+#include "RopePrototype.h"
+#include "Async/ParallelFor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "PhysicsEngine/BodySetup.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Collision Field Gather"), STAT_RopeFieldGather, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Collision Field Build"), STAT_RopeFieldBuild, STATGROUP_Rope);
+
+namespace RopeCollisionField
+{
+    // Summary: Cells per brick edge.
+    constexpr int32 BrickCells = 8;
+
+    // Summary: Samples per brick edge; the extra layer keeps interpolation inside one brick.
+    constexpr int32 SampleAxis = BrickCells + 1;
+
+    // Summary: Quantized samples stored per brick.
+    constexpr int32 SamplesPerBrick = SampleAxis * SampleAxis * SampleAxis;
+
+    // Summary: Largest brick table built; bigger regions stay on scene queries instead of allocating a huge table.
+    constexpr int32 MaxBrickTableSize = 1 << 18;
+
+    // Summary: Quantization steps on each side of zero.
+    constexpr float QuantizationSteps = 127.0f;
+
+    // Summary: Convex planes closer than this in normal and offset are merged.
+    constexpr float PlaneMergeTolerance = 0.01f;
+
+    // Summary: Returns the bricks per axis covering a region at the given cell size.
+    FIntVector GetBrickCounts(const FBox& InRegion, const float InVoxelSize)
+    {
+        const double BrickSize = FMath::Max(InVoxelSize, 1.0f) * BrickCells;
+        const FVector RegionSize = InRegion.GetSize();
+        return FIntVector(
+            FMath::Max(FMath::CeilToInt32(RegionSize.X / BrickSize), 1),
+            FMath::Max(FMath::CeilToInt32(RegionSize.Y / BrickSize), 1),
+            FMath::Max(FMath::CeilToInt32(RegionSize.Z / BrickSize), 1));
+    }
+
+    // Summary: Returns the brick table entries a region needs at the given cell size.
+    int64 GetBrickTableSize(const FBox& InRegion, const float InVoxelSize)
+    {
+        const FIntVector Counts = GetBrickCounts(InRegion, InVoxelSize);
+        return static_cast<int64>(Counts.X) * Counts.Y * Counts.Z;
+    }
+}
+
+#pragma region Methods
+#pragma region Primitive
+float FRopeFieldPrimitive::GetSignedDistance(const FVector& Location) const
+{
+    switch (Shape)
+    {
+    case ERopeFieldShape::Sphere:
+        return static_cast<float>(FVector::Dist(Location, Center)) - Radius;
+
+    case ERopeFieldShape::Box:
+    {
+        const FVector Local = Rotation.UnrotateVector(Location - Center).GetAbs() - Extent;
+        const float Outside = static_cast<float>(Local.ComponentMax(FVector::ZeroVector).Size());
+        const float Inside = static_cast<float>(FMath::Min(Local.GetMax(), 0.0));
+        return Outside + Inside;
+    }
+
+    case ERopeFieldShape::Capsule:
+    {
+        const FVector Axis = Rotation.GetAxisZ() * Extent.Z;
+        return static_cast<float>(FMath::PointDistToSegment(Location, Center - Axis, Center + Axis)) - Radius;
+    }
+
+    case ERopeFieldShape::Convex:
+    {
+        float Distance = -UE_BIG_NUMBER;
+
+        for (const FPlane& Plane : Planes)
+        {
+            Distance = FMath::Max(Distance, static_cast<float>(Plane.PlaneDot(Location)));
+        }
+
+        return Distance;
+    }
+    }
+
+    return UE_BIG_NUMBER;
+}
+#pragma endregion Primitive
+
+#pragma region Build
+FRopeCollisionField::FRopeCollisionField()
+{
+    Region = FBox(ForceInit);
+    Origin = FVector::ZeroVector;
+    VoxelSize = 0.0f;
+    BandWidth = 0.0f;
+    BrickCounts = FIntVector::ZeroValue;
+}
+
+void FRopeCollisionField::GatherStaticPrimitives(const UWorld& World, const FBox& GatherRegion, const ECollisionChannel Channel, const FCollisionQueryParams& Params, TArray<FRopeFieldPrimitive>& OutPrimitives, TArray<FBox>& OutFallbackBoxes)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeFieldGather);
+
+    TArray<FOverlapResult> Overlaps;
+    World.OverlapMultiByChannel(Overlaps, GatherRegion.GetCenter(), FQuat::Identity, Channel, FCollisionShape::MakeBox(GatherRegion.GetExtent()), Params);
+    TSet<TPair<const UPrimitiveComponent*, int32>> VisitedBodies;
+
+    for (const FOverlapResult& Overlap : Overlaps)
+    {
+        UPrimitiveComponent* const Component = Overlap.GetComponent();
+
+        // Movable bodies can leave the field at any time; the rope keeps tracing them in the scene.
+        if (Component == nullptr || Component->Mobility == EComponentMobility::Movable || Component->GetCollisionResponseToChannel(Channel) != ECR_Block)
+        {
+            continue;
+        }
+
+        bool bAlreadyVisited = false;
+        VisitedBodies.Add(TPair<const UPrimitiveComponent*, int32>(Component, Overlap.ItemIndex), &bAlreadyVisited);
+
+        if (bAlreadyVisited)
+        {
+            continue;
+        }
+
+        // Instances share one body setup but each overlaps with its own transform.
+        FTransform BodyTransform = Component->GetComponentTransform();
+
+        if (const UInstancedStaticMeshComponent* const Instanced = Cast<UInstancedStaticMeshComponent>(Component))
+        {
+            if (Overlap.ItemIndex == INDEX_NONE || !Instanced->GetInstanceTransform(Overlap.ItemIndex, BodyTransform, true))
+            {
+                continue;
+            }
+        }
+
+        const UBodySetup* const BodySetup = Component->GetBodySetup();
+
+        // Triangle meshes, heightfields, and tapered shapes have no cheap distance; their bounds stay on scene queries.
+        if (BodySetup == nullptr
+            || BodySetup->CollisionTraceFlag == CTF_UseComplexAsSimple
+            || BodySetup->AggGeom.TaperedCapsuleElems.Num() > 0
+            || BodySetup->AggGeom.GetElementCount() == 0)
+        {
+            OutFallbackBoxes.Add(Component->Bounds.GetBox());
+            continue;
+        }
+
+        const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+        const FVector Scale = BodyTransform.GetScale3D().GetAbs();
+        const FQuat BodyRotation = BodyTransform.GetRotation();
+
+        for (const FKSphereElem& Sphere : AggGeom.SphereElems)
+        {
+            FRopeFieldPrimitive& Primitive = OutPrimitives.AddDefaulted_GetRef();
+            Primitive.Shape = ERopeFieldShape::Sphere;
+            Primitive.Center = BodyTransform.TransformPosition(Sphere.Center);
+            Primitive.Radius = Sphere.Radius * static_cast<float>(Scale.GetMin());
+            Primitive.Bounds = FBox::BuildAABB(Primitive.Center, FVector(Primitive.Radius));
+        }
+
+        for (const FKBoxElem& Box : AggGeom.BoxElems)
+        {
+            FRopeFieldPrimitive& Primitive = OutPrimitives.AddDefaulted_GetRef();
+            Primitive.Shape = ERopeFieldShape::Box;
+            Primitive.Center = BodyTransform.TransformPosition(Box.Center);
+            Primitive.Rotation = BodyRotation * Box.Rotation.Quaternion();
+            Primitive.Extent = FVector(Box.X, Box.Y, Box.Z) * 0.5 * Scale;
+            Primitive.Bounds = FBox(-Primitive.Extent, Primitive.Extent).TransformBy(FTransform(Primitive.Rotation, Primitive.Center));
+        }
+
+        for (const FKSphylElem& Sphyl : AggGeom.SphylElems)
+        {
+            FRopeFieldPrimitive& Primitive = OutPrimitives.AddDefaulted_GetRef();
+            Primitive.Shape = ERopeFieldShape::Capsule;
+            Primitive.Center = BodyTransform.TransformPosition(Sphyl.Center);
+            Primitive.Rotation = BodyRotation * Sphyl.Rotation.Quaternion();
+            Primitive.Radius = Sphyl.Radius * static_cast<float>(FMath::Max(Scale.X, Scale.Y));
+            Primitive.Extent = FVector(0.0, 0.0, Sphyl.Length * 0.5 * Scale.Z);
+            Primitive.Bounds = FBox::BuildAABB(Primitive.Center, FVector(Primitive.Extent.Z + Primitive.Radius));
+        }
+
+        for (const FKConvexElem& Convex : AggGeom.ConvexElems)
+        {
+            const FTransform ElementTransform = Convex.GetTransform() * BodyTransform;
+            TArray<FVector> Vertices;
+            Vertices.Reserve(Convex.VertexData.Num());
+
+            for (const FVector& Vertex : Convex.VertexData)
+            {
+                Vertices.Add(ElementTransform.TransformPosition(Vertex));
+            }
+
+            // Hulls cooked without triangles have no planes; their bounds keep using scene queries.
+            if (Convex.IndexData.Num() < 3 || Vertices.Num() < 4)
+            {
+                OutFallbackBoxes.Add(FBox(Vertices));
+                continue;
+            }
+
+            FRopeFieldPrimitive& Primitive = OutPrimitives.AddDefaulted_GetRef();
+            Primitive.Shape = ERopeFieldShape::Convex;
+            Primitive.Bounds = FBox(Vertices);
+            const FVector Centroid = Primitive.Bounds.GetCenter();
+
+            for (int32 Index = 0; Index + 2 < Convex.IndexData.Num(); Index += 3)
+            {
+                FPlane Plane(Vertices[Convex.IndexData[Index]], Vertices[Convex.IndexData[Index + 1]], Vertices[Convex.IndexData[Index + 2]]);
+
+                if (Plane.GetNormal().IsNearlyZero())
+                {
+                    continue;
+                }
+
+                // Mirrored scale flips winding; keep every plane facing away from the hull.
+                if (Plane.PlaneDot(Centroid) > 0.0)
+                {
+                    Plane = Plane.Flip();
+                }
+
+                const bool bDuplicate = Primitive.Planes.ContainsByPredicate([&Plane](const FPlane& Existing)
+                {
+                    return Existing.Equals(Plane, RopeCollisionField::PlaneMergeTolerance);
+                });
+
+                if (!bDuplicate)
+                {
+                    Primitive.Planes.Add(Plane);
+                }
+            }
+        }
+    }
+}
+
+bool FRopeCollisionField::FitsBrickTable(const FBox& InRegion, const float InVoxelSize)
+{
+    return RopeCollisionField::GetBrickTableSize(InRegion, InVoxelSize) <= RopeCollisionField::MaxBrickTableSize;
+}
+
+bool FRopeCollisionField::Build(const FBox& InRegion, const float InVoxelSize, const float InBandWidth, const TConstArrayView<FRopeFieldPrimitive> Primitives, TArray<FBox>&& InFallbackBoxes)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeFieldBuild);
+    using namespace RopeCollisionField;
+
+    Reset();
+
+    if (!FitsBrickTable(InRegion, InVoxelSize))
+    {
+        return false;
+    }
+
+    VoxelSize = FMath::Max(InVoxelSize, 1.0f);
+    BandWidth = FMath::Max(InBandWidth, VoxelSize);
+    const double BrickSize = VoxelSize * BrickCells;
+    BrickCounts = GetBrickCounts(InRegion, VoxelSize);
+    const int64 TableSize = GetBrickTableSize(InRegion, VoxelSize);
+
+    Origin = InRegion.Min;
+    Region = InRegion;
+    FallbackBoxes = MoveTemp(InFallbackBoxes);
+    BrickTable.Init(INDEX_NONE, static_cast<int32>(TableSize));
+
+    // Bucket primitives into the bricks their band-expanded bounds touch; bricks nobody touches stay unallocated.
+    const auto GetBrickRange = [this, BrickSize](const FBox& Bounds, FIntVector& OutMin, FIntVector& OutMax)
+    {
+        const FVector Min = (Bounds.Min - BandWidth - Origin) / BrickSize;
+        const FVector Max = (Bounds.Max + BandWidth - Origin) / BrickSize;
+        OutMin = FIntVector(FMath::Max(FMath::FloorToInt32(Min.X), 0), FMath::Max(FMath::FloorToInt32(Min.Y), 0), FMath::Max(FMath::FloorToInt32(Min.Z), 0));
+        OutMax = FIntVector(FMath::Min(FMath::FloorToInt32(Max.X), BrickCounts.X - 1), FMath::Min(FMath::FloorToInt32(Max.Y), BrickCounts.Y - 1), FMath::Min(FMath::FloorToInt32(Max.Z), BrickCounts.Z - 1));
+        return OutMin.X <= OutMax.X && OutMin.Y <= OutMax.Y && OutMin.Z <= OutMax.Z;
+    };
+
+    TArray<int32> PrimitiveOffsets;
+    PrimitiveOffsets.SetNumZeroed(BrickTable.Num() + 1);
+
+    for (const FRopeFieldPrimitive& Primitive : Primitives)
+    {
+        FIntVector Min;
+        FIntVector Max;
+
+        if (!GetBrickRange(Primitive.Bounds, Min, Max))
+        {
+            continue;
+        }
+
+        for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+        {
+            for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+            {
+                for (int32 X = Min.X; X <= Max.X; ++X)
+                {
+                    ++PrimitiveOffsets[GetBrickTableIndex(FIntVector(X, Y, Z)) + 1];
+                }
+            }
+        }
+    }
+
+    TArray<int32> AllocatedBricks;
+
+    for (int32 TableIndex = 0; TableIndex < BrickTable.Num(); ++TableIndex)
+    {
+        if (PrimitiveOffsets[TableIndex + 1] > 0)
+        {
+            BrickTable[TableIndex] = AllocatedBricks.Add(TableIndex);
+        }
+
+        PrimitiveOffsets[TableIndex + 1] += PrimitiveOffsets[TableIndex];
+    }
+
+    TArray<int32> BrickPrimitives;
+    BrickPrimitives.SetNumUninitialized(PrimitiveOffsets.Last());
+    TArray<int32> FillCursors(PrimitiveOffsets.GetData(), BrickTable.Num());
+
+    for (int32 PrimitiveIndex = 0; PrimitiveIndex < Primitives.Num(); ++PrimitiveIndex)
+    {
+        FIntVector Min;
+        FIntVector Max;
+
+        if (!GetBrickRange(Primitives[PrimitiveIndex].Bounds, Min, Max))
+        {
+            continue;
+        }
+
+        for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+        {
+            for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+            {
+                for (int32 X = Min.X; X <= Max.X; ++X)
+                {
+                    BrickPrimitives[FillCursors[GetBrickTableIndex(FIntVector(X, Y, Z))]++] = PrimitiveIndex;
+                }
+            }
+        }
+    }
+
+    // Bricks are independent, so sampling spreads across workers even though the build itself already runs off the game thread.
+    BrickSamples.SetNumUninitialized(AllocatedBricks.Num() * SamplesPerBrick);
+
+    ParallelFor(AllocatedBricks.Num(), [this, &AllocatedBricks, &PrimitiveOffsets, &BrickPrimitives, Primitives](const int32 Slot)
+    {
+        const int32 TableIndex = AllocatedBricks[Slot];
+        const FIntVector Brick(TableIndex % BrickCounts.X, (TableIndex / BrickCounts.X) % BrickCounts.Y, TableIndex / (BrickCounts.X * BrickCounts.Y));
+        const FVector BrickOrigin = Origin + FVector(Brick) * (VoxelSize * BrickCells);
+        const TConstArrayView<int32> Candidates(BrickPrimitives.GetData() + PrimitiveOffsets[TableIndex], PrimitiveOffsets[TableIndex + 1] - PrimitiveOffsets[TableIndex]);
+        int8* const Samples = BrickSamples.GetData() + Slot * SamplesPerBrick;
+
+        for (int32 Z = 0; Z < SampleAxis; ++Z)
+        {
+            for (int32 Y = 0; Y < SampleAxis; ++Y)
+            {
+                for (int32 X = 0; X < SampleAxis; ++X)
+                {
+                    const FVector Location = BrickOrigin + FVector(X, Y, Z) * VoxelSize;
+                    float Distance = BandWidth;
+
+                    for (const int32 PrimitiveIndex : Candidates)
+                    {
+                        Distance = FMath::Min(Distance, Primitives[PrimitiveIndex].GetSignedDistance(Location));
+                    }
+
+                    const float Normalized = FMath::Clamp(Distance / BandWidth, -1.0f, 1.0f);
+                    Samples[(Z * SampleAxis + Y) * SampleAxis + X] = static_cast<int8>(FMath::RoundToInt32(Normalized * QuantizationSteps));
+                }
+            }
+        }
+    });
+
+    return true;
+}
+
+void FRopeCollisionField::Reset()
+{
+    Region = FBox(ForceInit);
+    Origin = FVector::ZeroVector;
+    BrickCounts = FIntVector::ZeroValue;
+    BrickTable.Reset();
+    BrickSamples.Reset();
+    FallbackBoxes.Reset();
+}
+#pragma endregion Build
+
+#pragma region Query
+bool FRopeCollisionField::IsBuilt() const
+{
+    return BrickTable.Num() > 0;
+}
+
+const FBox& FRopeCollisionField::GetRegion() const
+{
+    return Region;
+}
+
+bool FRopeCollisionField::CanResolve(const FVector& Location, const float Radius) const
+{
+    if (!IsBuilt() || !Region.ExpandBy(-Radius).IsInside(Location))
+    {
+        return false;
+    }
+
+    for (const FBox& FallbackBox : FallbackBoxes)
+    {
+        if (FallbackBox.ExpandBy(Radius).IsInside(Location))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+float FRopeCollisionField::Sample(const FVector& Location, FVector& OutNormal) const
+{
+    using namespace RopeCollisionField;
+
+    OutNormal = FVector::ZeroVector;
+    const FVector Cell = (Location - Origin) / VoxelSize;
+    const FIntVector CellIndex(FMath::FloorToInt32(Cell.X), FMath::FloorToInt32(Cell.Y), FMath::FloorToInt32(Cell.Z));
+    const FIntVector Brick(CellIndex.X / BrickCells, CellIndex.Y / BrickCells, CellIndex.Z / BrickCells);
+
+    if (CellIndex.X < 0 || CellIndex.Y < 0 || CellIndex.Z < 0 || Brick.X >= BrickCounts.X || Brick.Y >= BrickCounts.Y || Brick.Z >= BrickCounts.Z)
+    {
+        return BandWidth;
+    }
+
+    const int32 Slot = BrickTable[GetBrickTableIndex(Brick)];
+
+    if (Slot == INDEX_NONE)
+    {
+        return BandWidth;
+    }
+
+    // Trilinear blend of the cell's eight corners; the gradient comes from the same corners at no extra lookups.
+    const FIntVector Local = CellIndex - Brick * BrickCells;
+    const float FX = static_cast<float>(Cell.X - CellIndex.X);
+    const float FY = static_cast<float>(Cell.Y - CellIndex.Y);
+    const float FZ = static_cast<float>(Cell.Z - CellIndex.Z);
+    const int8* const Samples = BrickSamples.GetData() + Slot * SamplesPerBrick + (Local.Z * SampleAxis + Local.Y) * SampleAxis + Local.X;
+    constexpr int32 StepY = SampleAxis;
+    constexpr int32 StepZ = SampleAxis * SampleAxis;
+
+    const float C000 = Samples[0];
+    const float C100 = Samples[1];
+    const float C010 = Samples[StepY];
+    const float C110 = Samples[StepY + 1];
+    const float C001 = Samples[StepZ];
+    const float C101 = Samples[StepZ + 1];
+    const float C011 = Samples[StepZ + StepY];
+    const float C111 = Samples[StepZ + StepY + 1];
+
+    const float X00 = FMath::Lerp(C000, C100, FX);
+    const float X10 = FMath::Lerp(C010, C110, FX);
+    const float X01 = FMath::Lerp(C001, C101, FX);
+    const float X11 = FMath::Lerp(C011, C111, FX);
+    const float Y0 = FMath::Lerp(X00, X10, FY);
+    const float Y1 = FMath::Lerp(X01, X11, FY);
+    const float Value = FMath::Lerp(Y0, Y1, FZ);
+
+    const float GradientX = FMath::Lerp(FMath::Lerp(C100 - C000, C110 - C010, FY), FMath::Lerp(C101 - C001, C111 - C011, FY), FZ);
+    const float GradientY = FMath::Lerp(X10 - X00, X11 - X01, FZ);
+    const float GradientZ = Y1 - Y0;
+    OutNormal = FVector(GradientX, GradientY, GradientZ).GetSafeNormal();
+
+    return Value / QuantizationSteps * BandWidth;
+}
+
+float FRopeCollisionField::GetBandWidth() const
+{
+    return BandWidth;
+}
+
+int32 FRopeCollisionField::NumBricks() const
+{
+    return BrickSamples.Num() / RopeCollisionField::SamplesPerBrick;
+}
+
+SIZE_T FRopeCollisionField::GetAllocatedSize() const
+{
+    return BrickTable.GetAllocatedSize() + BrickSamples.GetAllocatedSize() + FallbackBoxes.GetAllocatedSize();
+}
+
+int32 FRopeCollisionField::GetBrickTableIndex(const FIntVector& Brick) const
+{
+    return (Brick.Z * BrickCounts.Y + Brick.Y) * BrickCounts.X + Brick.X;
+}
+#pragma endregion Query
+#pragma endregion Methods
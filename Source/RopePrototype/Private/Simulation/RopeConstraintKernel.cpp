@@ -0,0 +1,216 @@
+// Summary: Implements the SoA rope chain lanes and vector constraint kernels.
+#include "Simulation/RopeConstraintKernel.h"
+
+#include "Math/VectorRegister.h"
+
+namespace RopeConstraintKernel
+{
+    // Summary: Resizes one parity buffer set; new lanes start zeroed so padding is inert.
+    void ResizeParity(FRopeParityLanes& Lanes, const int32 Num)
+    {
+        for (TArray<float, TAlignedHeapAllocator<16>>* Buffer : {&Lanes.X, &Lanes.Y, &Lanes.Z, &Lanes.PreviousX, &Lanes.PreviousY, &Lanes.PreviousZ, &Lanes.InverseMasses, &Lanes.ChainIndices, &Lanes.IntegrateMask, &Lanes.SegmentMask, &Lanes.Lambdas, &Lanes.TetherLambdas})
+        {
+            Buffer->Reset();
+            Buffer->SetNumZeroed(Num);
+        }
+    }
+
+    // Summary: Builds a lane mask from a 0/1 float buffer.
+    FORCEINLINE VectorRegister4Float LoadMask(const float* Values)
+    {
+        return VectorCompareGT(VectorLoad(Values), VectorZeroFloat());
+    }
+
+    // Summary: Projects four segments joining lanes A[i] to B[i]; inactive lanes receive a zero correction.
+    FORCEINLINE void ProjectSegmentBlock(FRopeParityLanes& A, FRopeParityLanes& B, const int32 IndexA, const int32 IndexB, const VectorRegister4Float RestLength, const VectorRegister4Float AlphaTilde)
+    {
+        const VectorRegister4Float One = VectorOneFloat();
+        const VectorRegister4Float Small = VectorSetFloat1(KINDA_SMALL_NUMBER);
+        const VectorRegister4Float WeightA = VectorLoad(&A.InverseMasses[IndexA]);
+        const VectorRegister4Float WeightB = VectorLoad(&B.InverseMasses[IndexB]);
+        const VectorRegister4Float WeightSum = VectorAdd(VectorAdd(WeightA, WeightB), AlphaTilde);
+
+        const VectorRegister4Float AX = VectorLoad(&A.X[IndexA]);
+        const VectorRegister4Float AY = VectorLoad(&A.Y[IndexA]);
+        const VectorRegister4Float AZ = VectorLoad(&A.Z[IndexA]);
+        const VectorRegister4Float BX = VectorLoad(&B.X[IndexB]);
+        const VectorRegister4Float BY = VectorLoad(&B.Y[IndexB]);
+        const VectorRegister4Float BZ = VectorLoad(&B.Z[IndexB]);
+        const VectorRegister4Float DeltaX = VectorSubtract(BX, AX);
+        const VectorRegister4Float DeltaY = VectorSubtract(BY, AY);
+        const VectorRegister4Float DeltaZ = VectorSubtract(BZ, AZ);
+
+        // Separate multiply and add keep rounding identical to the scalar path on every platform.
+        const VectorRegister4Float DistanceSquared = VectorAdd(VectorAdd(VectorMultiply(DeltaX, DeltaX), VectorMultiply(DeltaY, DeltaY)), VectorMultiply(DeltaZ, DeltaZ));
+        const VectorRegister4Float Distance = VectorSqrt(DistanceSquared);
+
+        VectorRegister4Float Active = VectorBitwiseAnd(LoadMask(&A.SegmentMask[IndexA]), VectorCompareGT(WeightSum, Small));
+        Active = VectorBitwiseAnd(Active, VectorCompareGT(Distance, Small));
+
+        const VectorRegister4Float SafeWeightSum = VectorSelect(Active, WeightSum, One);
+        const VectorRegister4Float SafeDistance = VectorSelect(Active, Distance, One);
+        const VectorRegister4Float Lambda = VectorLoad(&A.Lambdas[IndexA]);
+        const VectorRegister4Float Constraint = VectorSubtract(Distance, RestLength);
+        VectorRegister4Float DeltaLambda = VectorDivide(VectorSubtract(VectorNegate(Constraint), VectorMultiply(AlphaTilde, Lambda)), SafeWeightSum);
+        DeltaLambda = VectorSelect(Active, DeltaLambda, VectorZeroFloat());
+        VectorStore(VectorAdd(Lambda, DeltaLambda), &A.Lambdas[IndexA]);
+
+        const VectorRegister4Float Scale = VectorDivide(DeltaLambda, SafeDistance);
+        const VectorRegister4Float CorrectionX = VectorMultiply(DeltaX, Scale);
+        const VectorRegister4Float CorrectionY = VectorMultiply(DeltaY, Scale);
+        const VectorRegister4Float CorrectionZ = VectorMultiply(DeltaZ, Scale);
+
+        VectorStore(VectorSubtract(AX, VectorMultiply(CorrectionX, WeightA)), &A.X[IndexA]);
+        VectorStore(VectorSubtract(AY, VectorMultiply(CorrectionY, WeightA)), &A.Y[IndexA]);
+        VectorStore(VectorSubtract(AZ, VectorMultiply(CorrectionZ, WeightA)), &A.Z[IndexA]);
+        VectorStore(VectorAdd(BX, VectorMultiply(CorrectionX, WeightB)), &B.X[IndexB]);
+        VectorStore(VectorAdd(BY, VectorMultiply(CorrectionY, WeightB)), &B.Y[IndexB]);
+        VectorStore(VectorAdd(BZ, VectorMultiply(CorrectionZ, WeightB)), &B.Z[IndexB]);
+    }
+
+    bool IsVectorized()
+    {
+        return PLATFORM_ENABLE_VECTORINTRINSICS != 0;
+    }
+
+    void Integrate(FRopeChainLanes& Lanes, const FVector3f& GravityStep, const float VelocityKeep)
+    {
+        const VectorRegister4Float Keep = VectorSetFloat1(VelocityKeep);
+        const VectorRegister4Float GravityX = VectorSetFloat1(GravityStep.X);
+        const VectorRegister4Float GravityY = VectorSetFloat1(GravityStep.Y);
+        const VectorRegister4Float GravityZ = VectorSetFloat1(GravityStep.Z);
+
+        for (FRopeParityLanes& Parity : Lanes.Parity)
+        {
+            for (int32 Lane = 0; Lane < Lanes.NumLanes; Lane += LaneWidth)
+            {
+                const VectorRegister4Float Free = LoadMask(&Parity.IntegrateMask[Lane]);
+                const VectorRegister4Float X = VectorLoad(&Parity.X[Lane]);
+                const VectorRegister4Float Y = VectorLoad(&Parity.Y[Lane]);
+                const VectorRegister4Float Z = VectorLoad(&Parity.Z[Lane]);
+                const VectorRegister4Float DisplacementX = VectorMultiply(VectorSubtract(X, VectorLoad(&Parity.PreviousX[Lane])), Keep);
+                const VectorRegister4Float DisplacementY = VectorMultiply(VectorSubtract(Y, VectorLoad(&Parity.PreviousY[Lane])), Keep);
+                const VectorRegister4Float DisplacementZ = VectorMultiply(VectorSubtract(Z, VectorLoad(&Parity.PreviousZ[Lane])), Keep);
+
+                VectorStore(VectorSelect(Free, X, VectorLoad(&Parity.PreviousX[Lane])), &Parity.PreviousX[Lane]);
+                VectorStore(VectorSelect(Free, Y, VectorLoad(&Parity.PreviousY[Lane])), &Parity.PreviousY[Lane]);
+                VectorStore(VectorSelect(Free, Z, VectorLoad(&Parity.PreviousZ[Lane])), &Parity.PreviousZ[Lane]);
+                VectorStore(VectorSelect(Free, VectorAdd(X, VectorAdd(DisplacementX, GravityX)), X), &Parity.X[Lane]);
+                VectorStore(VectorSelect(Free, VectorAdd(Y, VectorAdd(DisplacementY, GravityY)), Y), &Parity.Y[Lane]);
+                VectorStore(VectorSelect(Free, VectorAdd(Z, VectorAdd(DisplacementZ, GravityZ)), Z), &Parity.Z[Lane]);
+            }
+        }
+    }
+
+    void ProjectDistanceConstraints(FRopeChainLanes& Lanes, const float SegmentRestLength, const float AlphaTilde)
+    {
+        const VectorRegister4Float RestLength = VectorSetFloat1(SegmentRestLength);
+        const VectorRegister4Float Compliance = VectorSetFloat1(AlphaTilde);
+        FRopeParityLanes& Even = Lanes.Parity[0];
+        FRopeParityLanes& Odd = Lanes.Parity[1];
+
+        // Segments of one colour share no particle, so each block of four is independent.
+        for (int32 Lane = 0; Lane < Lanes.NumLanes; Lane += LaneWidth)
+        {
+            ProjectSegmentBlock(Even, Odd, Lane, Lane, RestLength, Compliance);
+        }
+
+        for (int32 Lane = 0; Lane < Lanes.NumLanes; Lane += LaneWidth)
+        {
+            ProjectSegmentBlock(Odd, Even, Lane, Lane + 1, RestLength, Compliance);
+        }
+    }
+
+    void ProjectLongRangeAttachments(FRopeChainLanes& Lanes, const float SegmentRestLength)
+    {
+        const VectorRegister4Float RestLength = VectorSetFloat1(SegmentRestLength);
+
+        for (FRopeParityLanes& Parity : Lanes.Parity)
+        {
+            for (int32 Lane = 0; Lane < Lanes.NumLanes; Lane += LaneWidth)
+            {
+                const VectorRegister4Float X = VectorLoad(&Parity.X[Lane]);
+                const VectorRegister4Float Y = VectorLoad(&Parity.Y[Lane]);
+                const VectorRegister4Float Z = VectorLoad(&Parity.Z[Lane]);
+                const VectorRegister4Float MaxDistance = VectorMultiply(RestLength, VectorLoad(&Parity.ChainIndices[Lane]));
+                const VectorRegister4Float DistanceSquared = VectorAdd(VectorAdd(VectorMultiply(X, X), VectorMultiply(Y, Y)), VectorMultiply(Z, Z));
+                const VectorRegister4Float Beyond = VectorBitwiseAnd(LoadMask(&Parity.InverseMasses[Lane]), VectorCompareGT(DistanceSquared, VectorMultiply(MaxDistance, MaxDistance)));
+                const VectorRegister4Float SafeDistance = VectorSqrt(VectorSelect(Beyond, DistanceSquared, VectorOneFloat()));
+                const VectorRegister4Float SafeWeight = VectorSelect(Beyond, VectorLoad(&Parity.InverseMasses[Lane]), VectorOneFloat());
+                const VectorRegister4Float Scale = VectorDivide(MaxDistance, SafeDistance);
+
+                // The projection is an XPBD step with zero compliance, so its multiplier is the pulled distance over the weight.
+                const VectorRegister4Float DeltaLambda = VectorDivide(VectorSubtract(SafeDistance, MaxDistance), SafeWeight);
+                const VectorRegister4Float TetherLambda = VectorLoad(&Parity.TetherLambdas[Lane]);
+                VectorStore(VectorAdd(TetherLambda, VectorSelect(Beyond, DeltaLambda, VectorZeroFloat())), &Parity.TetherLambdas[Lane]);
+
+                VectorStore(VectorSelect(Beyond, VectorMultiply(X, Scale), X), &Parity.X[Lane]);
+                VectorStore(VectorSelect(Beyond, VectorMultiply(Y, Scale), Y), &Parity.Y[Lane]);
+                VectorStore(VectorSelect(Beyond, VectorMultiply(Z, Scale), Z), &Parity.Z[Lane]);
+            }
+        }
+    }
+}
+
+#pragma region Methods
+void FRopeChainLanes::Gather(const TArray<FVector3f>& Positions, const TArray<FVector3f>& PreviousPositions, const TArray<float>& InverseMasses, const bool bFreeEnd)
+{
+    const int32 Count = Positions.Num();
+
+    if (Count != NumParticles)
+    {
+        // One spare block lets odd segments read Even[k + 1] past the last processed lane.
+        NumParticles = Count;
+        NumLanes = Align((Count + 1) / 2, RopeConstraintKernel::LaneWidth);
+
+        for (FRopeParityLanes& Lanes : Parity)
+        {
+            RopeConstraintKernel::ResizeParity(Lanes, NumLanes + RopeConstraintKernel::LaneWidth);
+        }
+    }
+
+    const int32 Last = Count - 1;
+    const int32 IntegrateEnd = bFreeEnd ? Count : Last;
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        FRopeParityLanes& Lanes = Parity[Index & 1];
+        const int32 Lane = Index >> 1;
+        Lanes.X[Lane] = Positions[Index].X;
+        Lanes.Y[Lane] = Positions[Index].Y;
+        Lanes.Z[Lane] = Positions[Index].Z;
+        Lanes.PreviousX[Lane] = PreviousPositions[Index].X;
+        Lanes.PreviousY[Lane] = PreviousPositions[Index].Y;
+        Lanes.PreviousZ[Lane] = PreviousPositions[Index].Z;
+        Lanes.InverseMasses[Lane] = InverseMasses[Index];
+        Lanes.ChainIndices[Lane] = static_cast<float>(Index);
+        Lanes.IntegrateMask[Lane] = Index > 0 && Index < IntegrateEnd && InverseMasses[Index] > 0.0f ? 1.0f : 0.0f;
+        Lanes.SegmentMask[Lane] = Index < Last ? 1.0f : 0.0f;
+        Lanes.Lambdas[Lane] = 0.0f;
+        Lanes.TetherLambdas[Lane] = 0.0f;
+    }
+}
+
+void FRopeChainLanes::Scatter(TArray<FVector3f>& Positions, TArray<FVector3f>& PreviousPositions, TArray<float>& Lambdas, TArray<float>& TetherLambdas) const
+{
+    const int32 Count = FMath::Min(Positions.Num(), NumParticles);
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FRopeParityLanes& Lanes = Parity[Index & 1];
+        const int32 Lane = Index >> 1;
+        Positions[Index] = FVector3f(Lanes.X[Lane], Lanes.Y[Lane], Lanes.Z[Lane]);
+        PreviousPositions[Index] = FVector3f(Lanes.PreviousX[Lane], Lanes.PreviousY[Lane], Lanes.PreviousZ[Lane]);
+
+        if (Lambdas.IsValidIndex(Index))
+        {
+            Lambdas[Index] = Lanes.Lambdas[Lane];
+        }
+
+        if (TetherLambdas.IsValidIndex(Index))
+        {
+            TetherLambdas[Index] = Lanes.TetherLambdas[Lane];
+        }
+    }
+}
+#pragma endregion Methods
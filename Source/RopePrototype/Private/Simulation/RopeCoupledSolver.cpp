@@ -0,0 +1,364 @@
+// Summary: Implements the island-split coupled rope solver.
+#include "Simulation/RopeCoupledSolver.h"
+
+#include "RopePrototype.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Coupled Solver Step"), STAT_RopeCoupledSolverStep, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rope Coupled Islands"), STAT_RopeCoupledIslands, STATGROUP_Rope);
+
+namespace RopeCoupledSolver
+{
+    // Summary: Below this island count the islands step inline; task dispatch would cost more than the math.
+    constexpr int32 MinParallelIslands = 4;
+
+    // Summary: Newtons per kg cm/s^2; body masses are in kg while the solver works in cm.
+    constexpr float NewtonsPerKgCmPerSecondSquared = 0.01f;
+}
+
+#pragma region Methods
+#pragma region Topology
+FRopeCoupledSolver::FRopeCoupledSolver()
+{
+    MaxViolation = 0.0f;
+    LastStepTime = 0.0f;
+    bIslandsDirty = true;
+}
+
+void FRopeCoupledSolver::Reset()
+{
+    Bodies.Reset();
+    PreviousLocations.Reset();
+    Ropes.Reset();
+    Spans.Reset();
+    IslandParents.Reset();
+    IslandBodies.Reset();
+    IslandSpans.Reset();
+    IslandBodyOffsets.Reset();
+    IslandSpanOffsets.Reset();
+    MaxViolation = 0.0f;
+    LastStepTime = 0.0f;
+    bIslandsDirty = true;
+}
+
+int32 FRopeCoupledSolver::AddBody(const FRopeCoupledBody& Body)
+{
+    PreviousLocations.Add(Body.Location);
+    bIslandsDirty = true;
+    return Bodies.Add(Body);
+}
+
+int32 FRopeCoupledSolver::AddRope(const FVector& AnchorLocation, const TConstArrayView<FRopeCoupledAttachment> Attachments, const float Compliance)
+{
+    FRope& Rope = Ropes.AddDefaulted_GetRef();
+    Rope.AnchorLocation = AnchorLocation;
+    Rope.FirstSpan = Spans.Num();
+    Rope.Compliance = FMath::Max(Compliance, 0.0f);
+    const int32 RopeIndex = Ropes.Num() - 1;
+
+    // Each attachment hangs from the one above it; the first hangs from the anchor.
+    int32 UpperBody = INDEX_NONE;
+
+    for (const FRopeCoupledAttachment& Attachment : Attachments)
+    {
+        if (!Bodies.IsValidIndex(Attachment.Body))
+        {
+            continue;
+        }
+
+        FSpan& Span = Spans.AddDefaulted_GetRef();
+        Span.BodyA = UpperBody;
+        Span.BodyB = Attachment.Body;
+        Span.Rope = RopeIndex;
+        Span.Length = FMath::Max(Attachment.SpanLength, 0.0f);
+        UpperBody = Attachment.Body;
+        ++Rope.NumSpans;
+    }
+
+    bIslandsDirty = true;
+    return RopeIndex;
+}
+
+void FRopeCoupledSolver::SetRopeActive(const int32 Rope, const bool bActive)
+{
+    if (Ropes.IsValidIndex(Rope) && Ropes[Rope].bActive != bActive)
+    {
+        Ropes[Rope].bActive = bActive;
+        bIslandsDirty = true;
+    }
+}
+
+void FRopeCoupledSolver::SetRopeAnchor(const int32 Rope, const FVector& AnchorLocation)
+{
+    if (Ropes.IsValidIndex(Rope))
+    {
+        Ropes[Rope].AnchorLocation = AnchorLocation;
+    }
+}
+
+void FRopeCoupledSolver::SetSpanLength(const int32 Rope, const int32 Attachment, const float SpanLength)
+{
+    if (Ropes.IsValidIndex(Rope) && Attachment >= 0 && Attachment < Ropes[Rope].NumSpans)
+    {
+        Spans[Ropes[Rope].FirstSpan + Attachment].Length = FMath::Max(SpanLength, 0.0f);
+    }
+}
+
+void FRopeCoupledSolver::BuildIslands()
+{
+    const int32 BodyCount = Bodies.Num();
+    IslandParents.SetNumUninitialized(BodyCount);
+
+    for (int32 Body = 0; Body < BodyCount; ++Body)
+    {
+        IslandParents[Body] = Body;
+    }
+
+    // Spans hanging from a fixed anchor link nothing; only body-to-body spans merge islands.
+    for (const FSpan& Span : Spans)
+    {
+        if (Ropes[Span.Rope].bActive && Span.BodyA != INDEX_NONE)
+        {
+            const int32 RootA = FindRoot(Span.BodyA);
+            const int32 RootB = FindRoot(Span.BodyB);
+
+            if (RootA != RootB)
+            {
+                IslandParents[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+            }
+        }
+    }
+
+    // Counting sort by root keeps each island's bodies and spans contiguous for cache-friendly sweeps.
+    TArray<int32> IslandOfRoot;
+    IslandOfRoot.Init(INDEX_NONE, BodyCount);
+    int32 IslandCount = 0;
+
+    for (int32 Body = 0; Body < BodyCount; ++Body)
+    {
+        const int32 Root = FindRoot(Body);
+
+        if (IslandOfRoot[Root] == INDEX_NONE)
+        {
+            IslandOfRoot[Root] = IslandCount++;
+        }
+    }
+
+    IslandBodyOffsets.Init(0, IslandCount + 1);
+    IslandSpanOffsets.Init(0, IslandCount + 1);
+
+    for (int32 Body = 0; Body < BodyCount; ++Body)
+    {
+        ++IslandBodyOffsets[IslandOfRoot[FindRoot(Body)] + 1];
+    }
+
+    for (const FSpan& Span : Spans)
+    {
+        if (Ropes[Span.Rope].bActive)
+        {
+            ++IslandSpanOffsets[IslandOfRoot[FindRoot(Span.BodyB)] + 1];
+        }
+    }
+
+    for (int32 Island = 0; Island < IslandCount; ++Island)
+    {
+        IslandBodyOffsets[Island + 1] += IslandBodyOffsets[Island];
+        IslandSpanOffsets[Island + 1] += IslandSpanOffsets[Island];
+    }
+
+    TArray<int32> BodyCursor(IslandBodyOffsets.GetData(), IslandCount);
+    TArray<int32> SpanCursor(IslandSpanOffsets.GetData(), IslandCount);
+    IslandBodies.SetNumUninitialized(BodyCount);
+    IslandSpans.SetNumUninitialized(IslandSpanOffsets[IslandCount]);
+
+    for (int32 Body = 0; Body < BodyCount; ++Body)
+    {
+        IslandBodies[BodyCursor[IslandOfRoot[FindRoot(Body)]]++] = Body;
+    }
+
+    // Spans keep rope order inside an island, so Gauss-Seidel sweeps each rope from its anchor down.
+    for (int32 SpanIndex = 0; SpanIndex < Spans.Num(); ++SpanIndex)
+    {
+        if (Ropes[Spans[SpanIndex].Rope].bActive)
+        {
+            IslandSpans[SpanCursor[IslandOfRoot[FindRoot(Spans[SpanIndex].BodyB)]]++] = SpanIndex;
+        }
+    }
+
+    bIslandsDirty = false;
+}
+
+int32 FRopeCoupledSolver::FindRoot(int32 Body)
+{
+    while (IslandParents[Body] != Body)
+    {
+        IslandParents[Body] = IslandParents[IslandParents[Body]];
+        Body = IslandParents[Body];
+    }
+
+    return Body;
+}
+#pragma endregion Topology
+
+#pragma region Solve
+void FRopeCoupledSolver::Step(const float DeltaTime, const FVector& Gravity, const int32 Iterations, const float Damping)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeCoupledSolverStep);
+
+    if (DeltaTime <= KINDA_SMALL_NUMBER || Bodies.IsEmpty())
+    {
+        return;
+    }
+
+    if (bIslandsDirty)
+    {
+        BuildIslands();
+    }
+
+    const int32 IslandCount = GetNumIslands();
+    const int32 IterationCount = FMath::Max(Iterations, 1);
+    SET_DWORD_STAT(STAT_RopeCoupledIslands, IslandCount);
+
+    // Islands share no body and no span, so they step on any thread without locks.
+    const EParallelForFlags Flags = IslandCount < RopeCoupledSolver::MinParallelIslands ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+    ParallelFor(IslandCount, [this, DeltaTime, &Gravity, IterationCount, Damping](const int32 Island)
+    {
+        StepIsland(Island, DeltaTime, Gravity, IterationCount, Damping);
+    }, Flags);
+
+    LastStepTime = DeltaTime;
+    MaxViolation = 0.0f;
+
+    for (const int32 SpanIndex : IslandSpans)
+    {
+        const FSpan& Span = Spans[SpanIndex];
+        const FVector Upper = Span.BodyA != INDEX_NONE ? Bodies[Span.BodyA].Location : Ropes[Span.Rope].AnchorLocation;
+        MaxViolation = FMath::Max(MaxViolation, static_cast<float>(FVector::Distance(Upper, Bodies[Span.BodyB].Location)) - Span.Length);
+    }
+}
+
+void FRopeCoupledSolver::StepIsland(const int32 Island, const float DeltaTime, const FVector& Gravity, const int32 Iterations, const float Damping)
+{
+    const TConstArrayView<int32> IslandBodyView(IslandBodies.GetData() + IslandBodyOffsets[Island], IslandBodyOffsets[Island + 1] - IslandBodyOffsets[Island]);
+    const TConstArrayView<int32> IslandSpanView(IslandSpans.GetData() + IslandSpanOffsets[Island], IslandSpanOffsets[Island + 1] - IslandSpanOffsets[Island]);
+    const float InverseStepSquared = 1.0f / (DeltaTime * DeltaTime);
+
+    // Predict every free body; kinematic bodies keep the location their owner wrote.
+    for (const int32 BodyIndex : IslandBodyView)
+    {
+        FRopeCoupledBody& Body = Bodies[BodyIndex];
+        PreviousLocations[BodyIndex] = Body.Location;
+
+        if (Body.InverseMass > 0.0f)
+        {
+            Body.Velocity += (Gravity + Body.ExternalAcceleration) * DeltaTime;
+            Body.Location += Body.Velocity * DeltaTime;
+        }
+    }
+
+    for (const int32 SpanIndex : IslandSpanView)
+    {
+        Spans[SpanIndex].Lambda = 0.0f;
+    }
+
+    // One Gauss-Seidel loop over every span of the island, so shared bodies see all their ropes in each iteration.
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        for (const int32 SpanIndex : IslandSpanView)
+        {
+            FSpan& Span = Spans[SpanIndex];
+            FRopeCoupledBody& Lower = Bodies[Span.BodyB];
+            FRopeCoupledBody* const Upper = Span.BodyA != INDEX_NONE ? &Bodies[Span.BodyA] : nullptr;
+            const FVector UpperLocation = Upper != nullptr ? Upper->Location : Ropes[Span.Rope].AnchorLocation;
+            const float WeightA = Upper != nullptr ? Upper->InverseMass : 0.0f;
+            const float WeightB = Lower.InverseMass;
+            const float AlphaTilde = Ropes[Span.Rope].Compliance * InverseStepSquared;
+            const float WeightSum = WeightA + WeightB + AlphaTilde;
+            const FVector Delta = Lower.Location - UpperLocation;
+            const float Distance = static_cast<float>(Delta.Size());
+
+            if (WeightSum <= KINDA_SMALL_NUMBER || Distance <= KINDA_SMALL_NUMBER)
+            {
+                continue;
+            }
+
+            // Unilateral XPBD: the accumulated multiplier is clamped so a slack rope never pushes bodies apart.
+            const float Constraint = Distance - Span.Length;
+            const float SolvedLambda = FMath::Min(Span.Lambda + (-Constraint - AlphaTilde * Span.Lambda) / WeightSum, 0.0f);
+            const float DeltaLambda = SolvedLambda - Span.Lambda;
+            Span.Lambda = SolvedLambda;
+
+            if (DeltaLambda == 0.0f)
+            {
+                continue;
+            }
+
+            const FVector Correction = Delta * (DeltaLambda / Distance);
+            Lower.Location += Correction * WeightB;
+
+            if (Upper != nullptr)
+            {
+                Upper->Location -= Correction * WeightA;
+            }
+        }
+    }
+
+    const float VelocityKeep = FMath::Clamp(1.0f - Damping * DeltaTime, 0.0f, 1.0f);
+
+    for (const int32 BodyIndex : IslandBodyView)
+    {
+        FRopeCoupledBody& Body = Bodies[BodyIndex];
+
+        if (Body.InverseMass > 0.0f)
+        {
+            Body.Velocity = (Body.Location - PreviousLocations[BodyIndex]) / DeltaTime * VelocityKeep;
+        }
+    }
+}
+#pragma endregion Solve
+
+#pragma region Query
+int32 FRopeCoupledSolver::NumBodies() const
+{
+    return Bodies.Num();
+}
+
+int32 FRopeCoupledSolver::NumRopes() const
+{
+    return Ropes.Num();
+}
+
+const FRopeCoupledBody& FRopeCoupledSolver::GetBody(const int32 Body) const
+{
+    return Bodies[Body];
+}
+
+FRopeCoupledBody& FRopeCoupledSolver::GetMutableBody(const int32 Body)
+{
+    return Bodies[Body];
+}
+
+float FRopeCoupledSolver::GetSpanTension(const int32 Rope, const int32 Attachment) const
+{
+    if (!Ropes.IsValidIndex(Rope) || !Ropes[Rope].bActive || Attachment < 0 || Attachment >= Ropes[Rope].NumSpans || LastStepTime <= KINDA_SMALL_NUMBER)
+    {
+        return 0.0f;
+    }
+
+    // The multiplier is kg cm per step squared, so dividing by the step squared gives the constraint force.
+    const float Lambda = Spans[Ropes[Rope].FirstSpan + Attachment].Lambda;
+    return -Lambda / (LastStepTime * LastStepTime) * RopeCoupledSolver::NewtonsPerKgCmPerSecondSquared;
+}
+
+float FRopeCoupledSolver::GetMaxViolation() const
+{
+    return MaxViolation;
+}
+
+int32 FRopeCoupledSolver::GetNumIslands() const
+{
+    return FMath::Max(IslandBodyOffsets.Num() - 1, 0);
+}
+#pragma endregion Query
+#pragma endregion Methods
@@ -0,0 +1,122 @@
+// Summary: Implements the timestamped rope input ring and its windowed consumption.
+#include "Simulation/RopeInputBuffer.h"
+
+namespace RopeInputBuffer
+{
+    // Summary: Longest platform-time gap one frame maps onto its substeps; older gaps are idle time, not input history.
+    constexpr double MaxFrameSpanSeconds = 0.25;
+}
+
+#pragma region Methods
+FRopeInputBuffer::FRopeInputBuffer()
+    : Head(0)
+    , Tail(0)
+    , Cursor(0.0)
+    , TimeScale(0.0)
+{
+}
+
+bool FRopeInputBuffer::Push(const FRopeInputSample& Sample)
+{
+    const uint32 WriteIndex = Head.load(std::memory_order_relaxed);
+
+    if (WriteIndex - Tail.load(std::memory_order_acquire) >= Capacity)
+    {
+        return false;
+    }
+
+    Samples[WriteIndex % Capacity] = Sample;
+
+    // Release publishes the sample before the consumer can see the new head.
+    Head.store(WriteIndex + 1, std::memory_order_release);
+    return true;
+}
+
+void FRopeInputBuffer::BeginFrame(const double FrameEndTime, const float SimulatedSeconds)
+{
+    // After idle time or on the first frame the window starts one frame back, not at the last consumed sample.
+    if (Cursor <= 0.0 || FrameEndTime - Cursor > RopeInputBuffer::MaxFrameSpanSeconds)
+    {
+        Cursor = FrameEndTime - FMath::Min(static_cast<double>(SimulatedSeconds), RopeInputBuffer::MaxFrameSpanSeconds);
+    }
+
+    Cursor = FMath::Min(Cursor, FrameEndTime);
+    TimeScale = SimulatedSeconds > KINDA_SMALL_NUMBER ? (FrameEndTime - Cursor) / SimulatedSeconds : 0.0;
+}
+
+FRopeInputWindow FRopeInputBuffer::Consume(const float SimulatedSeconds)
+{
+    return ConsumeUntil(Cursor + SimulatedSeconds * TimeScale);
+}
+
+FRopeInputWindow FRopeInputBuffer::ConsumeUntil(const double WindowEnd)
+{
+    const double WindowStart = Cursor;
+    const uint32 ReadEnd = Head.load(std::memory_order_acquire);
+    uint32 ReadIndex = Tail.load(std::memory_order_relaxed);
+
+    FVector2D SwingSum = FVector2D::ZeroVector;
+    FVector2D TapSwing = FVector2D::ZeroVector;
+    int32 TapClimbSign = 0;
+    double SegmentStart = WindowStart;
+
+    // Held input is piecewise constant between samples; weight each piece by the time it covers inside the window.
+    while (ReadIndex != ReadEnd)
+    {
+        const FRopeInputSample& Next = Samples[ReadIndex % Capacity];
+
+        if (Next.Time > WindowEnd)
+        {
+            break;
+        }
+
+        const double SegmentEnd = FMath::Max(Next.Time, SegmentStart);
+        SwingSum += FVector2D(Held.SwingInput) * (SegmentEnd - SegmentStart);
+
+        // A value that started inside this window and is already replaced is a tap the window must not average away.
+        if (Held.Time > WindowStart)
+        {
+            if (Held.SwingInput.SizeSquared() > TapSwing.SizeSquared())
+            {
+                TapSwing = FVector2D(Held.SwingInput);
+            }
+
+            if (Held.ClimbSign != 0)
+            {
+                TapClimbSign = Held.ClimbSign;
+            }
+        }
+
+        Held = Next;
+        SegmentStart = SegmentEnd;
+        ++ReadIndex;
+    }
+
+    Tail.store(ReadIndex, std::memory_order_release);
+
+    const double WindowSeconds = WindowEnd - WindowStart;
+    SwingSum += FVector2D(Held.SwingInput) * FMath::Max(WindowEnd - SegmentStart, 0.0);
+    Cursor = FMath::Max(Cursor, WindowEnd);
+
+    FRopeInputWindow Window;
+    Window.SwingInput = WindowSeconds > UE_DOUBLE_SMALL_NUMBER ? SwingSum / WindowSeconds : FVector2D(Held.SwingInput);
+    Window.ClimbSign = Held.ClimbSign;
+
+    // Taps only matter once released; a held value is already in the average and the climb sign.
+    if (Held.SwingInput.IsNearlyZero() && TapSwing.SizeSquared() > Window.SwingInput.SizeSquared())
+    {
+        Window.SwingInput = TapSwing;
+    }
+
+    Window.ClimbTapSign = Held.ClimbSign == 0 ? TapClimbSign : 0;
+    return Window;
+}
+
+void FRopeInputBuffer::Reset(const FRopeInputSample& HeldSample)
+{
+    Tail.store(Head.load(std::memory_order_acquire), std::memory_order_release);
+    Held = HeldSample;
+    Cursor = HeldSample.Time;
+    TimeScale = 0.0;
+}
+#pragma endregion Methods
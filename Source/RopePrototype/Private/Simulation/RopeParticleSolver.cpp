@@ -0,0 +1,437 @@
+// Summary: Implements the XPBD rope particle chain.
+#include "Simulation/RopeParticleSolver.h"
+
+#include "RopePrototype.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Solver Step"), STAT_RopeSolverStep, STATGROUP_Rope);
+
+namespace RopeParticleSolver
+{
+    // Summary: Distance slack tolerated before the character end counts as tensioned.
+    constexpr float TensionTolerance = 1.5f;
+}
+
+#pragma region Methods
+#pragma region Lifecycle
+template <typename T>
+TRopeParticleSolver<T>::TRopeParticleSolver()
+{
+    Origin = FVector::ZeroVector;
+    SegmentRestLength = 0;
+    Compliance = 0;
+    bEndTensioned = false;
+    bUseVectorKernel = true;
+    bFreeEnd = false;
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::Initialize(const FVector& AnchorLocation, const FVector& EndLocation, const int32 ParticleCount, const float TotalRestLength, const float EndInverseMass)
+{
+    const int32 Count = FMath::Max(ParticleCount, 2);
+    Positions.SetNumUninitialized(Count);
+    PreviousPositions.SetNumUninitialized(Count);
+    InverseMasses.SetNumUninitialized(Count);
+    Lambdas.SetNumZeroed(Count - 1);
+    TetherLambdas.SetNumZeroed(Count);
+    SegmentTensions.SetNumZeroed(Count - 1);
+
+    // Anchor becomes the local origin; only the end offset has to survive the narrowing conversion.
+    Origin = AnchorLocation;
+    const FLocalVector EndOffset(EndLocation - AnchorLocation);
+
+    // Distribute particles evenly on the straight line so the first step starts at rest.
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const T Alpha = static_cast<T>(Index) / static_cast<T>(Count - 1);
+        Positions[Index] = EndOffset * Alpha;
+        PreviousPositions[Index] = Positions[Index];
+        InverseMasses[Index] = 1;
+    }
+
+    InverseMasses[0] = 0;
+    InverseMasses[Count - 1] = FMath::Max(static_cast<T>(EndInverseMass), static_cast<T>(0));
+    SetTotalRestLength(TotalRestLength);
+    bEndTensioned = false;
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::Reset()
+{
+    Origin = FVector::ZeroVector;
+    Positions.Reset();
+    PreviousPositions.Reset();
+    InverseMasses.Reset();
+    Lambdas.Reset();
+    TetherLambdas.Reset();
+    SegmentTensions.Reset();
+    SegmentRestLength = 0;
+    bEndTensioned = false;
+}
+#pragma endregion Lifecycle
+
+#pragma region Configuration
+template <typename T>
+bool TRopeParticleSolver<T>::IsInitialized() const
+{
+    return Positions.Num() >= 2;
+}
+
+template <typename T>
+int32 TRopeParticleSolver<T>::Num() const
+{
+    return Positions.Num();
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SetTotalRestLength(const float TotalRestLength)
+{
+    const int32 SegmentCount = FMath::Max(Positions.Num() - 1, 1);
+    SegmentRestLength = static_cast<T>(FMath::Max(TotalRestLength, 0.0f)) / SegmentCount;
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SetAnchorLocation(const FVector& AnchorLocation)
+{
+    if (!IsInitialized() || AnchorLocation == Origin)
+    {
+        return;
+    }
+
+    // Rebase in double so a far-away anchor never loses precision, then shift the free particles by the small delta.
+    const FLocalVector Shift(Origin - AnchorLocation);
+    Origin = AnchorLocation;
+
+    for (int32 Index = 1; Index < Positions.Num(); ++Index)
+    {
+        Positions[Index] += Shift;
+        PreviousPositions[Index] += Shift;
+    }
+
+    // The anchor jumps with the origin, matching the world-space solver where particle 0 was simply overwritten.
+    PreviousPositions[0] = Shift;
+    Positions[0] = FLocalVector::ZeroVector;
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SetEndLocation(const FVector& EndLocation)
+{
+    if (!IsInitialized())
+    {
+        return;
+    }
+
+    const int32 Last = Positions.Num() - 1;
+    PreviousPositions[Last] = Positions[Last];
+    Positions[Last] = FLocalVector(EndLocation - Origin);
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SetLocalPositions(const FVector& InOrigin, const TArray<FLocalVector>& NewPositions)
+{
+    if (NewPositions.Num() != Positions.Num())
+    {
+        return;
+    }
+
+    SetAnchorLocation(InOrigin);
+    PreviousPositions = Positions;
+    Positions = NewPositions;
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SetCompliance(const float InCompliance)
+{
+    Compliance = static_cast<T>(FMath::Max(InCompliance, 0.0f));
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SetUseVectorKernel(const bool bInUseVectorKernel)
+{
+    bUseVectorKernel = bInUseVectorKernel;
+}
+
+template <typename T>
+bool TRopeParticleSolver<T>::IsUsingVectorKernel() const
+{
+    return bUseVectorKernel && std::is_same_v<T, float>;
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SetFreeEnd(const bool bInFreeEnd)
+{
+    bFreeEnd = bInFreeEnd;
+}
+#pragma endregion Configuration
+
+#pragma region Solve
+template <typename T>
+void TRopeParticleSolver<T>::Step(const float DeltaTime, const FVector& Gravity, const int32 Iterations, const float Damping)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeSolverStep);
+
+    if (!IsInitialized() || DeltaTime <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    const int32 Last = Positions.Num() - 1;
+    const T StepTime = static_cast<T>(DeltaTime);
+    const FLocalVector GravityStep = FLocalVector(Gravity) * (StepTime * StepTime);
+    const T VelocityKeep = FMath::Clamp(static_cast<T>(1) - static_cast<T>(Damping) * StepTime, static_cast<T>(0), static_cast<T>(1));
+    const T AlphaTilde = Compliance / (StepTime * StepTime);
+    const int32 IterationCount = FMath::Max(Iterations, 1);
+
+    // Long-range tethers clamp every particle to its rest distance, which would cancel any elastic stretch.
+    const bool bLongRangeAttachments = Compliance <= 0;
+
+    if (StepVectorKernel(GravityStep, VelocityKeep, AlphaTilde, IterationCount, bLongRangeAttachments))
+    {
+        bEndTensioned = Positions[Last].Size() >= SegmentRestLength * Last - RopeParticleSolver::TensionTolerance;
+        UpdateSegmentTensions(StepTime);
+        return;
+    }
+
+    // Verlet-integrate interior particles; the anchor is pinned and the end is driven by the character unless it hangs free.
+    const int32 IntegrateEnd = bFreeEnd ? Last + 1 : Last;
+
+    for (int32 Index = 1; Index < IntegrateEnd; ++Index)
+    {
+        if (InverseMasses[Index] <= 0)
+        {
+            continue;
+        }
+
+        const FLocalVector Displacement = (Positions[Index] - PreviousPositions[Index]) * VelocityKeep;
+        PreviousPositions[Index] = Positions[Index];
+        Positions[Index] += Displacement + GravityStep;
+    }
+
+    FMemory::Memzero(Lambdas.GetData(), Lambdas.Num() * sizeof(T));
+    FMemory::Memzero(TetherLambdas.GetData(), TetherLambdas.Num() * sizeof(T));
+
+    for (int32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+    {
+        SolveDistanceConstraints(AlphaTilde);
+
+        if (bLongRangeAttachments)
+        {
+            SolveLongRangeAttachments();
+        }
+    }
+
+    // Particle 0 is the origin, so the end's local length is its distance from the anchor.
+    const T EndDistance = Positions[Last].Size();
+    bEndTensioned = EndDistance >= SegmentRestLength * Last - RopeParticleSolver::TensionTolerance;
+    UpdateSegmentTensions(StepTime);
+}
+
+template <typename T>
+bool TRopeParticleSolver<T>::StepVectorKernel(const FLocalVector& GravityStep, const T VelocityKeep, const T AlphaTilde, const int32 IterationCount, const bool bLongRangeAttachments)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if (!bUseVectorKernel || !RopeConstraintKernel::IsVectorized())
+        {
+            return false;
+        }
+
+        // Gather once per step; all iterations run on the SoA lanes.
+        Lanes.Gather(Positions, PreviousPositions, InverseMasses, bFreeEnd);
+        RopeConstraintKernel::Integrate(Lanes, GravityStep, VelocityKeep);
+
+        for (int32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+        {
+            RopeConstraintKernel::ProjectDistanceConstraints(Lanes, SegmentRestLength, AlphaTilde);
+
+            if (bLongRangeAttachments)
+            {
+                RopeConstraintKernel::ProjectLongRangeAttachments(Lanes, SegmentRestLength);
+            }
+        }
+
+        Lanes.Scatter(Positions, PreviousPositions, Lambdas, TetherLambdas);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SolveDistanceConstraints(const T AlphaTilde)
+{
+    const int32 SegmentCount = Positions.Num() - 1;
+
+    // Red-black order: even segments share no particle, then odd segments; the vector kernel projects each colour in parallel.
+    for (int32 Colour = 0; Colour < 2; ++Colour)
+    {
+        for (int32 Segment = Colour; Segment < SegmentCount; Segment += 2)
+        {
+            const int32 IndexA = Segment;
+            const int32 IndexB = Segment + 1;
+            const T WeightA = InverseMasses[IndexA];
+            const T WeightB = InverseMasses[IndexB];
+            const T WeightSum = WeightA + WeightB + AlphaTilde;
+
+            if (WeightSum <= KINDA_SMALL_NUMBER)
+            {
+                continue;
+            }
+
+            const FLocalVector Delta = Positions[IndexB] - Positions[IndexA];
+            const T Distance = Delta.Size();
+
+            if (Distance <= KINDA_SMALL_NUMBER)
+            {
+                continue;
+            }
+
+            // XPBD update: accumulate the multiplier so compliance stays timestep independent.
+            const T Constraint = Distance - SegmentRestLength;
+            const T DeltaLambda = (-Constraint - AlphaTilde * Lambdas[Segment]) / WeightSum;
+            Lambdas[Segment] += DeltaLambda;
+
+            const FLocalVector Correction = Delta * (DeltaLambda / Distance);
+            Positions[IndexA] -= Correction * WeightA;
+            Positions[IndexB] += Correction * WeightB;
+        }
+    }
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SolveLongRangeAttachments()
+{
+    // The anchor sits at the local origin, so each particle's position is already its offset from the anchor.
+    for (int32 Index = 1; Index < Positions.Num(); ++Index)
+    {
+        if (InverseMasses[Index] <= 0)
+        {
+            continue;
+        }
+
+        const T MaxDistance = SegmentRestLength * Index;
+        const T DistanceSquared = Positions[Index].SizeSquared();
+
+        if (DistanceSquared <= FMath::Square(MaxDistance))
+        {
+            continue;
+        }
+
+        // Zero-compliance XPBD step along the anchor direction; its multiplier is the pulled distance over the weight.
+        const T Distance = FMath::Sqrt(DistanceSquared);
+        TetherLambdas[Index] += (Distance - MaxDistance) / InverseMasses[Index];
+        Positions[Index] *= MaxDistance / Distance;
+    }
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::UpdateSegmentTensions(const T StepTime)
+{
+    const int32 SegmentCount = Lambdas.Num();
+    SegmentTensions.SetNumUninitialized(SegmentCount);
+    const T InverseStepSquared = static_cast<T>(1) / (StepTime * StepTime);
+    T TetherSum = 0;
+
+    // A tether on particle i pulls it toward the anchor through every segment above it, so walk from the end and
+    // carry the suffix sum. Stretched segments have negative multipliers; a rope cannot push, so compression reads zero.
+    for (int32 Segment = SegmentCount - 1; Segment >= 0; --Segment)
+    {
+        TetherSum += TetherLambdas.IsValidIndex(Segment + 1) ? TetherLambdas[Segment + 1] : 0;
+        const T Multiplier = FMath::Max(-Lambdas[Segment], static_cast<T>(0)) + TetherSum;
+        SegmentTensions[Segment] = static_cast<float>(Multiplier * InverseStepSquared);
+    }
+}
+#pragma endregion Solve
+
+#pragma region Query
+template <typename T>
+FVector TRopeParticleSolver<T>::GetEndLocation() const
+{
+    return IsInitialized() ? GetWorldPosition(Positions.Num() - 1) : FVector::ZeroVector;
+}
+
+template <typename T>
+bool TRopeParticleSolver<T>::IsEndTensioned() const
+{
+    return bEndTensioned;
+}
+
+template <typename T>
+float TRopeParticleSolver<T>::GetSegmentRestLength() const
+{
+    return static_cast<float>(SegmentRestLength);
+}
+
+template <typename T>
+int32 TRopeParticleSolver<T>::GetSegmentCount() const
+{
+    return FMath::Max(Positions.Num() - 1, 0);
+}
+
+template <typename T>
+float TRopeParticleSolver<T>::GetSegmentTension(const int32 Segment) const
+{
+    return SegmentTensions.IsValidIndex(Segment) ? SegmentTensions[Segment] : 0.0f;
+}
+
+template <typename T>
+const TArray<float>& TRopeParticleSolver<T>::GetSegmentTensions() const
+{
+    return SegmentTensions;
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::SetSegmentTensions(const TArray<float>& NewTensions)
+{
+    if (NewTensions.Num() == GetSegmentCount())
+    {
+        SegmentTensions = NewTensions;
+    }
+}
+
+template <typename T>
+const FVector& TRopeParticleSolver<T>::GetOrigin() const
+{
+    return Origin;
+}
+
+template <typename T>
+FVector TRopeParticleSolver<T>::GetWorldPosition(const int32 Index) const
+{
+    return Origin + FVector(Positions[Index]);
+}
+
+template <typename T>
+void TRopeParticleSolver<T>::GetWorldPositions(TArray<FVector>& OutPositions) const
+{
+    OutPositions.SetNumUninitialized(Positions.Num());
+
+    for (int32 Index = 0; Index < Positions.Num(); ++Index)
+    {
+        OutPositions[Index] = Origin + FVector(Positions[Index]);
+    }
+}
+
+template <typename T>
+const TArray<typename TRopeParticleSolver<T>::FLocalVector>& TRopeParticleSolver<T>::GetLocalPositions() const
+{
+    return Positions;
+}
+
+template <typename T>
+const TArray<typename TRopeParticleSolver<T>::FLocalVector>& TRopeParticleSolver<T>::GetLocalPreviousPositions() const
+{
+    return PreviousPositions;
+}
+
+template <typename T>
+TArray<typename TRopeParticleSolver<T>::FLocalVector>& TRopeParticleSolver<T>::GetMutableLocalPositions()
+{
+    return Positions;
+}
+#pragma endregion Query
+#pragma endregion Methods
+
+template class ROPEPROTOTYPE_API TRopeParticleSolver<float>;
+template class ROPEPROTOTYPE_API TRopeParticleSolver<double>;
@@ -0,0 +1,859 @@
+// Summary: Implements rope simulation benchmark scenarios and the console entry point.
+#include "Simulation/RopeSimBenchmarks.h"
+
+#include "RopePrototype.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Simulation/RopeCollisionField.h"
+#include "Simulation/RopeCoupledSolver.h"
+#include "Simulation/RopeParticleSolver.h"
+#include "Simulation/RopeSimCore.h"
+
+namespace RopeSimBenchmarks
+{
+    // Summary: Fixed step used by all scenarios so results compare across machines.
+    constexpr float BenchmarkDeltaTime = 1.0f / 60.0f;
+
+    // Summary: Anchor shared by core scenarios.
+    const FVector BenchmarkAnchor(0.0f, 0.0f, 1000.0f);
+
+    // Summary: Gravity shared by all scenarios.
+    const FVector BenchmarkGravity(0.0f, 0.0f, -980.0f);
+
+    // Summary: Anchor 50 km from the origin, where world-space floats only resolve about half a centimeter.
+    const FVector FarBenchmarkAnchor(5.0e6, -5.0e6, 1.0e5);
+
+    // Summary: Rope length of the particle chain scenarios in cm.
+    constexpr float ParticleRopeLength = 600.0f;
+
+    // Summary: Simulated time of each integrator drift run in seconds.
+    constexpr float DriftSimulatedSeconds = 60.0f;
+
+    // Summary: Step rates compared by the integrator drift runs in Hz.
+    constexpr int32 DriftStepRates[] = {15, 30, 60, 120};
+
+    // Summary: Largest relative energy drift accepted when recommending an integrator.
+    constexpr double EnergyDriftTolerance = 0.01;
+
+    // Summary: Character mass of the coupled scenarios in kg.
+    constexpr float CoupledBodyMass = 80.0f;
+
+    // Summary: Spacing between the anchors of independent coupled ropes in cm.
+    constexpr float CoupledRopeSpacing = 500.0f;
+
+    // Summary: Cell size of the collision field scenario in cm.
+    constexpr float FieldVoxelSize = 10.0f;
+
+    // Summary: Band width of the collision field scenario in cm.
+    constexpr float FieldBandWidth = 40.0f;
+
+    // Summary: Sweep radius of the scene query scenario in cm, matching the rope component's default collision radius.
+    constexpr float SceneQueryRadius = 4.0f;
+
+    // Summary: World ticks that let the physics scene publish freshly registered bodies to its query structure.
+    constexpr int32 SceneSettleTicks = 2;
+
+    // Summary: Stiff gameplay spring for the elastic scenario in 1/s^2; an explicit spring would need substeps at the benchmark step.
+    constexpr float BenchmarkElasticStiffness = 20000.0f;
+
+    // Summary: Builds a result from a measured wall time.
+    FRopeBenchmarkResult MakeResult(const FString& Name, const int32 Steps, const double Seconds)
+    {
+        FRopeBenchmarkResult Result;
+        Result.Name = Name;
+        Result.Steps = Steps;
+        Result.NanosecondsPerStep = Steps > 0 ? Seconds * 1.0e9 / Steps : 0.0;
+        Result.StepsPerSecond = Seconds > 0.0 ? Steps / Seconds : 0.0;
+        return Result;
+    }
+
+    // Summary: Swings a chain of the given precision and returns the wall time; optionally records the solved end every step.
+    template <typename SolverType>
+    double TimeParticleSolver(const FVector& Anchor, const int32 ParticleCount, const int32 Steps, TArray<FVector>* OutEndLocations, const bool bUseVectorKernel = true)
+    {
+        SolverType Solver;
+        Solver.SetUseVectorKernel(bUseVectorKernel);
+        Solver.Initialize(Anchor, Anchor + FVector(ParticleRopeLength, 0.0f, 0.0f), ParticleCount, ParticleRopeLength, 0.05f);
+
+        if (OutEndLocations != nullptr)
+        {
+            OutEndLocations->SetNumUninitialized(Steps);
+        }
+
+        // Drive the character end along a pendulum arc so constraints stay active every step.
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            const float Angle = FMath::Sin(Step * BenchmarkDeltaTime * 2.0f) * 1.2f;
+            const FVector End = Anchor + FVector(FMath::Sin(Angle), 0.0f, -FMath::Cos(Angle)) * ParticleRopeLength;
+            Solver.SetEndLocation(End);
+            Solver.Step(BenchmarkDeltaTime, BenchmarkGravity, 8, 0.05f);
+
+            if (OutEndLocations != nullptr)
+            {
+                (*OutEndLocations)[Step] = Solver.GetEndLocation();
+            }
+        }
+
+        return FPlatformTime::Seconds() - StartSeconds;
+    }
+
+    FRopeBenchmarkResult RunParticleSolver(const int32 ParticleCount, const int32 Steps)
+    {
+        const double Seconds = TimeParticleSolver<FRopeParticleSolver>(BenchmarkAnchor, ParticleCount, Steps, nullptr);
+        return MakeResult(FString::Printf(TEXT("ParticleSolver/%d"), ParticleCount), Steps, Seconds);
+    }
+
+    void RunParticleSolverPrecision(const int32 ParticleCount, const int32 Steps, TArray<FRopeBenchmarkResult>& OutResults)
+    {
+        TArray<FVector> ReferenceEnds;
+        TArray<FVector> SingleEnds;
+        const double ReferenceSeconds = TimeParticleSolver<FRopeParticleSolverDouble>(FarBenchmarkAnchor, ParticleCount, Steps, &ReferenceEnds);
+        const double SingleSeconds = TimeParticleSolver<FRopeParticleSolver>(FarBenchmarkAnchor, ParticleCount, Steps, &SingleEnds);
+
+        double MaxErrorCm = 0.0;
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            MaxErrorCm = FMath::Max(MaxErrorCm, FVector::Distance(ReferenceEnds[Step], SingleEnds[Step]));
+        }
+
+        OutResults.Add(MakeResult(FString::Printf(TEXT("ParticleSolver.FarDouble/%d"), ParticleCount), Steps, ReferenceSeconds));
+        FRopeBenchmarkResult& SingleResult = OutResults.Add_GetRef(MakeResult(FString::Printf(TEXT("ParticleSolver.FarFloat/%d"), ParticleCount), Steps, SingleSeconds));
+        SingleResult.MaxErrorCm = MaxErrorCm;
+    }
+
+    void RunParticleSolverKernels(const int32 ParticleCount, const int32 Steps, TArray<FRopeBenchmarkResult>& OutResults)
+    {
+        TArray<FVector> ScalarEnds;
+        TArray<FVector> VectorEnds;
+        const double ScalarSeconds = TimeParticleSolver<FRopeParticleSolver>(BenchmarkAnchor, ParticleCount, Steps, &ScalarEnds, false);
+        const double VectorSeconds = TimeParticleSolver<FRopeParticleSolver>(BenchmarkAnchor, ParticleCount, Steps, &VectorEnds, true);
+
+        double MaxErrorCm = 0.0;
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            MaxErrorCm = FMath::Max(MaxErrorCm, FVector::Distance(ScalarEnds[Step], VectorEnds[Step]));
+        }
+
+        OutResults.Add(MakeResult(FString::Printf(TEXT("ParticleSolver.Scalar/%d"), ParticleCount), Steps, ScalarSeconds));
+        FRopeBenchmarkResult& VectorResult = OutResults.Add_GetRef(MakeResult(FString::Printf(TEXT("ParticleSolver.Vector/%d"), ParticleCount), Steps, VectorSeconds));
+        VectorResult.MaxErrorCm = MaxErrorCm;
+        VectorResult.Speedup = VectorSeconds > 0.0 ? ScalarSeconds / VectorSeconds : 0.0;
+
+        if (MaxErrorCm > KernelToleranceCm)
+        {
+            UE_LOG(LogRopePrototype, Warning, TEXT("Rope vector kernel drifted %.5f cm from the scalar path with %d particles"), MaxErrorCm, ParticleCount);
+        }
+    }
+
+    // Summary: Builds a hanging input and state with the character displaced sideways from the anchor.
+    void MakeHangingScenario(FRopeSimInput& OutInput, FRopeSimState& OutState)
+    {
+        OutState.RopeLength = 600.0f;
+        OutInput.DeltaTime = BenchmarkDeltaTime;
+        OutInput.AnchorLocation = BenchmarkAnchor;
+        OutInput.ActorLocation = BenchmarkAnchor + FVector(300.0f, 0.0f, -520.0f);
+        OutInput.Gravity = BenchmarkGravity;
+    }
+
+    // Summary: Returns how far the solved character sits beyond rope length from the swing pivot in cm.
+    double GetRopeStretch(const FRopeSimInput& Input, const FRopeSimState& State)
+    {
+        return FVector::Distance(State.Location, Input.AnchorLocation) - State.RopeLength;
+    }
+
+    // Summary: Mimics the falling movement update between rope steps: gravity then free motion.
+    void AdvanceFalling(FRopeSimInput& Input, const FRopeSimState& State)
+    {
+        Input.ActorVelocity = State.Velocity + Input.Gravity * Input.DeltaTime;
+        Input.ActorLocation = State.Location + Input.ActorVelocity * Input.DeltaTime;
+    }
+
+    FRopeBenchmarkResult RunSwing(const int32 Steps)
+    {
+        const FRopeSimParams Params;
+        FRopeSimInput Input;
+        FRopeSimState State;
+        MakeHangingScenario(Input, State);
+        double MaxStretch = 0.0;
+
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            Input.SwingInput = FVector2D(0.0f, (Step / 90) % 2 == 0 ? 1.0f : -1.0f);
+            FRopeSimCore::StepHanging(Params, Input, State);
+            MaxStretch = FMath::Max(MaxStretch, GetRopeStretch(Input, State));
+            AdvanceFalling(Input, State);
+        }
+
+        FRopeBenchmarkResult Result = MakeResult(TEXT("Core/Swing"), Steps, FPlatformTime::Seconds() - StartSeconds);
+        Result.MaxErrorCm = MaxStretch;
+        return Result;
+    }
+
+    // Summary: Hangs a self-integrated character for the given steps and returns the wall time and the largest stretch past rope length.
+    double TimeStretchMode(const FRopeSimParams& Params, const int32 Steps, float& OutMaxStretch)
+    {
+        FRopeSimInput Input;
+        FRopeSimState State;
+        MakeHangingScenario(Input, State);
+        Input.bIntegrateActor = true;
+        OutMaxStretch = 0.0f;
+
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            Input.SwingInput = FVector2D(0.0f, (Step / 90) % 2 == 0 ? 1.0f : -1.0f);
+            FRopeSimCore::StepHanging(Params, Input, State);
+            Input.ActorLocation = State.Location;
+            Input.ActorVelocity = State.Velocity;
+
+            const float Stretch = FVector::Distance(State.Location, Input.AnchorLocation) - State.RopeLength;
+            OutMaxStretch = FMath::IsFinite(Stretch) ? FMath::Max(OutMaxStretch, Stretch) : TNumericLimits<float>::Max();
+        }
+
+        return FPlatformTime::Seconds() - StartSeconds;
+    }
+
+    void RunStretchModes(const int32 Steps, TArray<FRopeBenchmarkResult>& OutResults)
+    {
+        FRopeSimParams RigidParams;
+        FRopeSimParams ElasticParams;
+        ElasticParams.bElastic = true;
+        ElasticParams.ElasticStiffness = BenchmarkElasticStiffness;
+
+        float RigidStretch = 0.0f;
+        float ElasticStretch = 0.0f;
+        const double RigidSeconds = TimeStretchMode(RigidParams, Steps, RigidStretch);
+        const double ElasticSeconds = TimeStretchMode(ElasticParams, Steps, ElasticStretch);
+
+        OutResults.Add(MakeResult(TEXT("Core/Hanging.Rigid"), Steps, RigidSeconds));
+        FRopeBenchmarkResult& ElasticResult = OutResults.Add_GetRef(MakeResult(TEXT("Core/Hanging.Elastic"), Steps, ElasticSeconds));
+        ElasticResult.Speedup = ElasticSeconds > 0.0 ? RigidSeconds / ElasticSeconds : 0.0;
+
+        // A diverging spring would stretch without bound; the implicit step keeps it near its static sag.
+        if (ElasticStretch > ParticleRopeLength)
+        {
+            UE_LOG(LogRopePrototype, Warning, TEXT("Elastic rope stretched %.1f cm at stiffness %.0f; the implicit spring should stay bounded"), ElasticStretch, BenchmarkElasticStiffness);
+        }
+    }
+
+    // Summary: Swings an undamped pendulum released at 45 degrees for the drift duration and returns the wall time and largest relative energy drift.
+    double TimeSwingIntegrator(const ERopeSimIntegrator Integrator, const int32 StepRate, const int32 Steps, double& OutEnergyDrift)
+    {
+        FRopeSimParams Params;
+        Params.SwingIntegrator = Integrator;
+        Params.SwingDamping = 0.0f;
+
+        // A two-particle chain keeps the solver out of the timing so the integrators are compared on their own.
+        Params.ParticleCount = 2;
+
+        FRopeSimInput Input;
+        FRopeSimState State;
+        State.RopeLength = ParticleRopeLength;
+        Input.DeltaTime = 1.0f / StepRate;
+        Input.AnchorLocation = BenchmarkAnchor;
+        Input.ActorLocation = BenchmarkAnchor + FVector(1.0f, 0.0f, -1.0f).GetSafeNormal() * ParticleRopeLength;
+        Input.Gravity = BenchmarkGravity;
+        Input.bIntegrateActor = true;
+
+        // Energy per unit mass measured from the lowest point of the swing.
+        const double LowestZ = BenchmarkAnchor.Z - ParticleRopeLength;
+        const double GravityMagnitude = -BenchmarkGravity.Z;
+        const double InitialEnergy = GravityMagnitude * (Input.ActorLocation.Z - LowestZ);
+        OutEnergyDrift = 0.0;
+
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            FRopeSimCore::StepHanging(Params, Input, State);
+            Input.ActorLocation = State.Location;
+            Input.ActorVelocity = State.Velocity;
+
+            const double Energy = 0.5 * State.Velocity.SizeSquared() + GravityMagnitude * (State.Location.Z - LowestZ);
+            OutEnergyDrift = FMath::Max(OutEnergyDrift, FMath::Abs(Energy - InitialEnergy) / InitialEnergy);
+        }
+
+        return FPlatformTime::Seconds() - StartSeconds;
+    }
+
+    void RunSwingIntegrators(TArray<FRopeBenchmarkResult>& OutResults)
+    {
+        static const TCHAR* const IntegratorNames[] = {TEXT("Explicit"), TEXT("Rattle"), TEXT("RK4")};
+        const ERopeSimIntegrator Integrators[] = {ERopeSimIntegrator::Explicit, ERopeSimIntegrator::Rattle, ERopeSimIntegrator::RK4};
+        FString Cheapest = TEXT("none");
+        double CheapestSeconds = TNumericLimits<double>::Max();
+
+        for (const int32 StepRate : DriftStepRates)
+        {
+            const int32 Steps = FMath::CeilToInt32(DriftSimulatedSeconds * StepRate);
+
+            for (int32 Index = 0; Index < UE_ARRAY_COUNT(Integrators); ++Index)
+            {
+                double EnergyDrift = 0.0;
+                const double Seconds = TimeSwingIntegrator(Integrators[Index], StepRate, Steps, EnergyDrift);
+                const FString Name = FString::Printf(TEXT("Swing.%s/%dHz"), IntegratorNames[Index], StepRate);
+                FRopeBenchmarkResult& Result = OutResults.Add_GetRef(MakeResult(Name, Steps, Seconds));
+                Result.EnergyDrift = EnergyDrift;
+
+                // Cost of a whole simulated minute, so a low rate with a pricier integrator can win.
+                if (EnergyDrift <= EnergyDriftTolerance && Seconds < CheapestSeconds)
+                {
+                    CheapestSeconds = Seconds;
+                    Cheapest = Name;
+                }
+            }
+        }
+
+        UE_LOG(LogRopePrototype, Display, TEXT("Cheapest swing integrator within %.1f%% energy drift over %.0f s: %s"), EnergyDriftTolerance * 100.0, DriftSimulatedSeconds, *Cheapest);
+    }
+
+    void RunCoupledSolver(const int32 RopeCount, const int32 Steps, TArray<FRopeBenchmarkResult>& OutResults)
+    {
+        const FVector Offset(300.0f, 0.0f, -520.0f);
+        const float RopeLength = static_cast<float>(Offset.Size());
+
+        // Current path: every rope is one character on one constraint, stepped by the core one rope at a time.
+        FRopeSimParams Params;
+        Params.ParticleCount = 2;
+        Params.SwingDamping = 0.0f;
+        TArray<FRopeSimInput> Inputs;
+        TArray<FRopeSimState> States;
+        Inputs.SetNum(RopeCount);
+        States.SetNum(RopeCount);
+
+        for (int32 Rope = 0; Rope < RopeCount; ++Rope)
+        {
+            FRopeSimInput& Input = Inputs[Rope];
+            Input.DeltaTime = BenchmarkDeltaTime;
+            Input.AnchorLocation = BenchmarkAnchor + FVector(0.0f, Rope * CoupledRopeSpacing, 0.0f);
+            Input.ActorLocation = Input.AnchorLocation + Offset;
+            Input.Gravity = BenchmarkGravity;
+            Input.bIntegrateActor = true;
+            States[Rope].RopeLength = RopeLength;
+        }
+
+        const double SingleStart = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            for (int32 Rope = 0; Rope < RopeCount; ++Rope)
+            {
+                FRopeSimCore::StepHanging(Params, Inputs[Rope], States[Rope]);
+                Inputs[Rope].ActorLocation = States[Rope].Location;
+                Inputs[Rope].ActorVelocity = States[Rope].Velocity;
+            }
+        }
+
+        const double SingleSeconds = FPlatformTime::Seconds() - SingleStart;
+
+        // Coupled path on the same ropes; nothing links them, so every rope is its own island.
+        FRopeCoupledSolver Solver;
+
+        for (int32 Rope = 0; Rope < RopeCount; ++Rope)
+        {
+            FRopeCoupledBody Body;
+            Body.Location = Inputs[Rope].AnchorLocation + Offset;
+            Body.InverseMass = 1.0f / CoupledBodyMass;
+            const FRopeCoupledAttachment Attachment = {Solver.AddBody(Body), RopeLength};
+            Solver.AddRope(Inputs[Rope].AnchorLocation, MakeArrayView(&Attachment, 1));
+        }
+
+        float MaxViolation = 0.0f;
+        const double CoupledStart = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            Solver.Step(BenchmarkDeltaTime, BenchmarkGravity, 1, 0.0f);
+            MaxViolation = FMath::Max(MaxViolation, Solver.GetMaxViolation());
+        }
+
+        const double CoupledSeconds = FPlatformTime::Seconds() - CoupledStart;
+
+        OutResults.Add(MakeResult(FString::Printf(TEXT("Coupled.SingleConstraint/%d"), RopeCount), Steps, SingleSeconds));
+        FRopeBenchmarkResult& CoupledResult = OutResults.Add_GetRef(MakeResult(FString::Printf(TEXT("Coupled.Islands/%d"), RopeCount), Steps, CoupledSeconds));
+        CoupledResult.MaxErrorCm = MaxViolation;
+        CoupledResult.Speedup = CoupledSeconds > 0.0 ? SingleSeconds / CoupledSeconds : 0.0;
+    }
+
+    // Summary: Steps a prepared coupled solver and returns the wall time and the largest stretch past any span length.
+    double TimeCoupledScenario(FRopeCoupledSolver& Solver, const int32 Steps, float& OutMaxViolation)
+    {
+        OutMaxViolation = 0.0f;
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            // Alternate swing input on the first body so the coupling keeps moving.
+            Solver.GetMutableBody(0).ExternalAcceleration = FVector((Step / 90) % 2 == 0 ? 600.0f : -600.0f, 0.0f, 0.0f);
+            Solver.Step(BenchmarkDeltaTime, BenchmarkGravity, 8, 0.05f);
+            OutMaxViolation = FMath::Max(OutMaxViolation, Solver.GetMaxViolation());
+        }
+
+        return FPlatformTime::Seconds() - StartSeconds;
+    }
+
+    void RunCoupledScenarios(const int32 Steps, TArray<FRopeBenchmarkResult>& OutResults)
+    {
+        FRopeCoupledBody Body;
+        Body.InverseMass = 1.0f / CoupledBodyMass;
+
+        // Co-op: two characters on one rope, the lower one hanging 300 cm below the upper one.
+        FRopeCoupledSolver CoOp;
+        Body.Location = BenchmarkAnchor + FVector(200.0f, 0.0f, -250.0f);
+        const int32 Upper = CoOp.AddBody(Body);
+        Body.Location = BenchmarkAnchor + FVector(200.0f, 0.0f, -550.0f);
+        const int32 Lower = CoOp.AddBody(Body);
+        const FRopeCoupledAttachment CoOpAttachments[] = {{Upper, 320.0f}, {Lower, 300.0f}};
+        CoOp.AddRope(BenchmarkAnchor, CoOpAttachments);
+
+        // Dual rope: one character held between two anchors 600 cm apart.
+        FRopeCoupledSolver DualRope;
+        Body.Location = BenchmarkAnchor + FVector(0.0f, 0.0f, -300.0f);
+        const int32 Held = DualRope.AddBody(Body);
+        const FRopeCoupledAttachment DualAttachment = {Held, 450.0f};
+        DualRope.AddRope(BenchmarkAnchor + FVector(0.0f, -300.0f, 0.0f), MakeArrayView(&DualAttachment, 1));
+        DualRope.AddRope(BenchmarkAnchor + FVector(0.0f, 300.0f, 0.0f), MakeArrayView(&DualAttachment, 1));
+
+        float CoOpViolation = 0.0f;
+        float DualViolation = 0.0f;
+        const double CoOpSeconds = TimeCoupledScenario(CoOp, Steps, CoOpViolation);
+        const double DualSeconds = TimeCoupledScenario(DualRope, Steps, DualViolation);
+
+        OutResults.Add_GetRef(MakeResult(TEXT("Coupled.CoOp"), Steps, CoOpSeconds)).MaxErrorCm = CoOpViolation;
+        OutResults.Add_GetRef(MakeResult(TEXT("Coupled.DualRope"), Steps, DualSeconds)).MaxErrorCm = DualViolation;
+    }
+
+    // Summary: Lays out a floor under the swing, pillars around it, and a few crates and rocks as static field primitives.
+    void MakeFieldScene(TArray<FRopeFieldPrimitive>& OutPrimitives)
+    {
+        const FVector FloorCenter = BenchmarkAnchor - FVector(0.0f, 0.0f, ParticleRopeLength + 20.0f);
+
+        FRopeFieldPrimitive& Floor = OutPrimitives.AddDefaulted_GetRef();
+        Floor.Shape = ERopeFieldShape::Box;
+        Floor.Center = FloorCenter - FVector(0.0f, 0.0f, 50.0f);
+        Floor.Extent = FVector(1000.0f, 1000.0f, 50.0f);
+        Floor.Bounds = FBox::BuildAABB(Floor.Center, Floor.Extent);
+
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            const float Angle = Index * UE_TWO_PI / 16.0f;
+            const FVector Ring = FloorCenter + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * (Index % 2 == 0 ? 450.0f : 250.0f);
+            FRopeFieldPrimitive& Primitive = OutPrimitives.AddDefaulted_GetRef();
+
+            switch (Index % 4)
+            {
+            case 0:
+                Primitive.Shape = ERopeFieldShape::Capsule;
+                Primitive.Center = Ring + FVector(0.0f, 0.0f, 300.0f);
+                Primitive.Radius = 30.0f;
+                Primitive.Extent = FVector(0.0f, 0.0f, 270.0f);
+                Primitive.Bounds = FBox::BuildAABB(Primitive.Center, FVector(30.0f, 30.0f, 300.0f));
+                break;
+
+            case 1:
+            case 3:
+                Primitive.Shape = ERopeFieldShape::Box;
+                Primitive.Center = Ring + FVector(0.0f, 0.0f, 40.0f);
+                Primitive.Rotation = FQuat(FVector::UpVector, Angle);
+                Primitive.Extent = FVector(40.0f, 60.0f, 40.0f);
+                Primitive.Bounds = FBox(-Primitive.Extent, Primitive.Extent).TransformBy(FTransform(Primitive.Rotation, Primitive.Center));
+                break;
+
+            default:
+            {
+                // Octahedral rock as a convex hull.
+                Primitive.Shape = ERopeFieldShape::Convex;
+                const FVector RockCenter = Ring + FVector(0.0f, 0.0f, 30.0f);
+
+                for (const float X : {-1.0f, 1.0f})
+                {
+                    for (const float Y : {-1.0f, 1.0f})
+                    {
+                        for (const float Z : {-1.0f, 1.0f})
+                        {
+                            const FVector Normal = FVector(X, Y, Z).GetSafeNormal();
+                            Primitive.Planes.Add(FPlane(RockCenter + Normal * 50.0f, Normal));
+                        }
+                    }
+                }
+
+                Primitive.Bounds = FBox::BuildAABB(RockCenter, FVector(90.0f));
+                break;
+            }
+            }
+        }
+    }
+
+    // Summary: Places a chain hanging from the benchmark anchor, rotating and dipping into the scene as the step advances.
+    void MakeFieldChain(const int32 Step, TArray<FVector>& OutPositions)
+    {
+        const float Time = Step * BenchmarkDeltaTime;
+        const FVector Swing = FVector(FMath::Cos(Time * 0.7f), FMath::Sin(Time * 0.7f), 0.0f) * FMath::Sin(Time * 2.1f) * 0.8f;
+        const FVector Direction = (Swing - FVector::UpVector).GetSafeNormal();
+        const int32 Count = OutPositions.Num();
+
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            OutPositions[Index] = BenchmarkAnchor + Direction * ((ParticleRopeLength + 40.0f) * Index / FMath::Max(Count - 1, 1));
+        }
+    }
+
+    void RunCollisionField(const int32 ParticleCount, const int32 Steps, TArray<FRopeBenchmarkResult>& OutResults)
+    {
+        TArray<FRopeFieldPrimitive> Primitives;
+        MakeFieldScene(Primitives);
+        const FBox Region = FBox::BuildAABB(BenchmarkAnchor, FVector(ParticleRopeLength * 1.25f + FieldBandWidth));
+
+        FRopeCollisionField Field;
+        const double BuildStart = FPlatformTime::Seconds();
+        Field.Build(Region, FieldVoxelSize, FieldBandWidth, Primitives, TArray<FBox>());
+        const double BuildSeconds = FPlatformTime::Seconds() - BuildStart;
+
+        TArray<FVector> Positions;
+        Positions.SetNumZeroed(ParticleCount);
+        float Checksum = 0.0f;
+
+        // Reference: evaluate every primitive for every particle, the work a per-particle narrow phase repeats each step.
+        const double DirectStart = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            MakeFieldChain(Step, Positions);
+
+            for (const FVector& Position : Positions)
+            {
+                float Distance = FieldBandWidth;
+
+                for (const FRopeFieldPrimitive& Primitive : Primitives)
+                {
+                    Distance = FMath::Min(Distance, Primitive.GetSignedDistance(Position));
+                }
+
+                Checksum += Distance;
+            }
+        }
+
+        const double DirectSeconds = FPlatformTime::Seconds() - DirectStart;
+        const double FieldStart = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            MakeFieldChain(Step, Positions);
+
+            for (const FVector& Position : Positions)
+            {
+                FVector Normal;
+                Checksum += Field.Sample(Position, Normal);
+            }
+        }
+
+        const double FieldSeconds = FPlatformTime::Seconds() - FieldStart;
+
+        // Accuracy where it matters: inside the band, compared against the exact primitives.
+        double MaxError = 0.0;
+
+        for (int32 Step = 0; Step < Steps; Step += 16)
+        {
+            MakeFieldChain(Step, Positions);
+
+            for (const FVector& Position : Positions)
+            {
+                float Exact = FieldBandWidth;
+
+                for (const FRopeFieldPrimitive& Primitive : Primitives)
+                {
+                    Exact = FMath::Min(Exact, Primitive.GetSignedDistance(Position));
+                }
+
+                if (FMath::Abs(Exact) < FieldBandWidth * 0.9f)
+                {
+                    FVector Normal;
+                    MaxError = FMath::Max(MaxError, static_cast<double>(FMath::Abs(Field.Sample(Position, Normal) - Exact)));
+                }
+            }
+        }
+
+        UE_LOG(LogRopePrototype, Verbose, TEXT("Field scenario checksum %f, %d bricks, %llu bytes"), Checksum, Field.NumBricks(), static_cast<uint64>(Field.GetAllocatedSize()));
+
+        OutResults.Add(MakeResult(FString::Printf(TEXT("Field.Build/%dKB"), static_cast<int32>(Field.GetAllocatedSize() / 1024)), 1, BuildSeconds));
+        OutResults.Add(MakeResult(FString::Printf(TEXT("Field.Direct/%d"), ParticleCount), Steps, DirectSeconds));
+        FRopeBenchmarkResult& FieldResult = OutResults.Add_GetRef(MakeResult(FString::Printf(TEXT("Field.Sampled/%d"), ParticleCount), Steps, FieldSeconds));
+        FieldResult.MaxErrorCm = MaxError;
+        FieldResult.Speedup = FieldSeconds > 0.0 ? DirectSeconds / FieldSeconds : 0.0;
+    }
+
+    // Summary: Registers one static, query-only collision component for a field primitive on the given actor.
+    void AddScenePrimitive(AActor& Actor, const FRopeFieldPrimitive& Primitive)
+    {
+        UShapeComponent* Shape = nullptr;
+
+        switch (Primitive.Shape)
+        {
+        case ERopeFieldShape::Box:
+        {
+            UBoxComponent* const Box = NewObject<UBoxComponent>(&Actor);
+            Box->InitBoxExtent(Primitive.Extent);
+            Shape = Box;
+            break;
+        }
+
+        case ERopeFieldShape::Capsule:
+        {
+            UCapsuleComponent* const Capsule = NewObject<UCapsuleComponent>(&Actor);
+            Capsule->InitCapsuleSize(Primitive.Radius, Primitive.Extent.Z + Primitive.Radius);
+            Shape = Capsule;
+            break;
+        }
+
+        default:
+        {
+            // The convex rock becomes the sphere its planes enclose, the cheapest shape to sweep, so the scene side of the
+            // comparison is never overstated.
+            float Radius = Primitive.Radius;
+
+            if (Primitive.Shape == ERopeFieldShape::Convex)
+            {
+                Radius = TNumericLimits<float>::Max();
+
+                for (const FPlane& Plane : Primitive.Planes)
+                {
+                    Radius = FMath::Min(Radius, FMath::Abs(static_cast<float>(Plane.PlaneDot(Primitive.Bounds.GetCenter()))));
+                }
+            }
+
+            USphereComponent* const Sphere = NewObject<USphereComponent>(&Actor);
+            Sphere->InitSphereRadius(Radius);
+            Shape = Sphere;
+            break;
+        }
+        }
+
+        const FVector Center = Primitive.Shape == ERopeFieldShape::Convex ? Primitive.Bounds.GetCenter() : Primitive.Center;
+        Shape->SetMobility(EComponentMobility::Static);
+        Shape->SetWorldLocationAndRotation(Center, Primitive.Rotation);
+        Shape->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+        Shape->SetCollisionResponseToAllChannels(ECR_Block);
+        Shape->RegisterComponent();
+    }
+
+    void RunCollisionSceneQueries(const int32 ParticleCount, const int32 Steps, TArray<FRopeBenchmarkResult>& OutResults)
+    {
+        if (GEngine == nullptr)
+        {
+            UE_LOG(LogRopePrototype, Warning, TEXT("Rope scene query benchmark needs an engine; skipped."));
+            return;
+        }
+
+        TArray<FRopeFieldPrimitive> Primitives;
+        MakeFieldScene(Primitives);
+
+        // A private game world holds the same primitives as static bodies in a real physics scene.
+        UWorld* const World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("RopeBenchmarkWorld"));
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+        World->InitializeActorsForPlay(FURL());
+
+        AActor* const SceneActor = World->SpawnActor<AActor>();
+
+        for (const FRopeFieldPrimitive& Primitive : Primitives)
+        {
+            AddScenePrimitive(*SceneActor, Primitive);
+        }
+
+        for (int32 Tick = 0; Tick < SceneSettleTicks; ++Tick)
+        {
+            World->Tick(LEVELTICK_All, BenchmarkDeltaTime);
+        }
+
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(RopeBenchmarkSweep), false);
+        const FCollisionShape Shape = FCollisionShape::MakeSphere(SceneQueryRadius);
+        const FVector FloorTop = BenchmarkAnchor - FVector(0.0f, 0.0f, ParticleRopeLength + 20.0f);
+        FHitResult Hit;
+
+        if (!World->SweepSingleByChannel(Hit, FloorTop + FVector(0.0f, 0.0f, 100.0f), FloorTop - FVector(0.0f, 0.0f, 10.0f), FQuat::Identity, ECC_Visibility, Shape, Params))
+        {
+            UE_LOG(LogRopePrototype, Warning, TEXT("Rope scene query benchmark missed its floor; the physics scene holds no bodies and timings are meaningless."));
+        }
+
+        FRopeCollisionField Field;
+        const FBox Region = FBox::BuildAABB(BenchmarkAnchor, FVector(ParticleRopeLength * 1.25f + FieldBandWidth));
+        Field.Build(Region, FieldVoxelSize, FieldBandWidth, Primitives, TArray<FBox>());
+
+        TArray<FVector> PreviousPositions;
+        TArray<FVector> Positions;
+        PreviousPositions.SetNumZeroed(ParticleCount);
+        Positions.SetNumZeroed(ParticleCount);
+        int32 NumHits = 0;
+        float Checksum = 0.0f;
+
+        // The path the field replaces: one sphere sweep per particle from its previous position, as the rope did per step.
+        const double SceneStart = FPlatformTime::Seconds();
+
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            MakeFieldChain(Step, PreviousPositions);
+            MakeFieldChain(Step + 1, Positions);
+
+            for (int32 Index = 0; Index < ParticleCount; ++Index)
+            {
+                NumHits += World->SweepSingleByChannel(Hit, PreviousPositions[Index], Positions[Index], FQuat::Identity, ECC_Visibility, Shape, Params) ? 1 : 0;
+            }
+        }
+
+        const double SceneSeconds = FPlatformTime::Seconds() - SceneStart;
+        const double FieldStart = FPlatformTime::Seconds();
+
+        // Same chain generation as the sweep loop, so the two timings differ only in the collision query.
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            MakeFieldChain(Step, PreviousPositions);
+            MakeFieldChain(Step + 1, Positions);
+
+            for (const FVector& Position : Positions)
+            {
+                FVector Normal;
+                Checksum += Field.Sample(Position, Normal);
+            }
+        }
+
+        const double FieldSeconds = FPlatformTime::Seconds() - FieldStart;
+        UE_LOG(LogRopePrototype, Verbose, TEXT("Scene query scenario: %d sweep hits, field checksum %f"), NumHits, Checksum);
+
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+
+        OutResults.Add(MakeResult(FString::Printf(TEXT("Field.SceneSweeps/%d"), ParticleCount), Steps, SceneSeconds));
+        FRopeBenchmarkResult& FieldResult = OutResults.Add_GetRef(MakeResult(FString::Printf(TEXT("Field.SampledVsScene/%d"), ParticleCount), Steps, FieldSeconds));
+        FieldResult.Speedup = FieldSeconds > 0.0 ? SceneSeconds / FieldSeconds : 0.0;
+    }
+
+    FRopeBenchmarkResult RunTether(const int32 Steps)
+    {
+        const FRopeSimParams Params;
+        FRopeSimInput Input;
+        FRopeSimState State;
+        State.RopeLength = 900.0f;
+        Input.DeltaTime = BenchmarkDeltaTime;
+        Input.AnchorLocation = BenchmarkAnchor;
+        Input.ActorLocation = FVector(0.0f, 0.0f, 90.0f);
+        Input.Gravity = BenchmarkGravity;
+
+        const FVector WalkVelocity(600.0f, 0.0f, 0.0f);
+        double MaxStretch = 0.0;
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        // Walk straight out so the tether alternates between slack and pulling back.
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            Input.ActorVelocity = WalkVelocity;
+            FRopeSimCore::StepTether(Params, Input, State);
+            MaxStretch = FMath::Max(MaxStretch, GetRopeStretch(Input, State));
+            Input.ActorLocation = State.Location + WalkVelocity * Input.DeltaTime;
+
+            if (Step % 240 == 0)
+            {
+                Input.ActorLocation = FVector(0.0f, 0.0f, 90.0f);
+            }
+        }
+
+        FRopeBenchmarkResult Result = MakeResult(TEXT("Core/Tether"), Steps, FPlatformTime::Seconds() - StartSeconds);
+        Result.MaxErrorCm = MaxStretch;
+        return Result;
+    }
+
+    FRopeBenchmarkResult RunClimb(const int32 Steps)
+    {
+        FRopeSimParams Params;
+        Params.ClimbMinLength = ClimbBenchmarkMinLength;
+        FRopeSimInput Input;
+        FRopeSimState State;
+        MakeHangingScenario(Input, State);
+        double MinLength = State.RopeLength;
+        double MaxLength = State.RopeLength;
+        double MaxStretch = 0.0;
+
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        // Eight-second phases climb further than the whole rope, so both clamps are reached every cycle.
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            State.ClimbInputSign = (Step / 480) % 2 == 0 ? 1 : -1;
+            FRopeSimCore::StepHanging(Params, Input, State);
+            MinLength = FMath::Min(MinLength, static_cast<double>(State.RopeLength));
+            MaxLength = FMath::Max(MaxLength, static_cast<double>(State.RopeLength));
+            MaxStretch = FMath::Max(MaxStretch, GetRopeStretch(Input, State));
+            AdvanceFalling(Input, State);
+        }
+
+        FRopeBenchmarkResult Result = MakeResult(TEXT("Core/Climb"), Steps, FPlatformTime::Seconds() - StartSeconds);
+        Result.MaxErrorCm = MaxStretch;
+        Result.MinRopeLength = MinLength;
+        Result.MaxRopeLength = MaxLength;
+        return Result;
+    }
+
+    void RunAll(const int32 Steps, TArray<FRopeBenchmarkResult>& OutResults)
+    {
+        const int32 StepCount = Steps > 0 ? Steps : DefaultSteps;
+
+        for (const int32 ParticleCount : {8, 32, 128})
+        {
+            OutResults.Add(RunParticleSolver(ParticleCount, StepCount));
+            RunParticleSolverPrecision(ParticleCount, StepCount, OutResults);
+            RunParticleSolverKernels(ParticleCount, StepCount, OutResults);
+        }
+
+        OutResults.Add(RunSwing(StepCount));
+        RunStretchModes(StepCount, OutResults);
+        RunSwingIntegrators(OutResults);
+
+        for (const int32 RopeCount : {1, 16, 256})
+        {
+            RunCoupledSolver(RopeCount, StepCount, OutResults);
+        }
+
+        RunCoupledScenarios(StepCount, OutResults);
+
+        for (const int32 ParticleCount : {16, 32, 64})
+        {
+            RunCollisionField(ParticleCount, StepCount, OutResults);
+        }
+
+        OutResults.Add(RunTether(StepCount));
+        OutResults.Add(RunClimb(StepCount));
+    }
+
+    void LogResults(const TArray<FRopeBenchmarkResult>& Results)
+    {
+        for (const FRopeBenchmarkResult& Result : Results)
+        {
+            UE_LOG(LogRopePrototype, Display, TEXT("%-32s %8d steps %12.1f ns/step %14.0f steps/s %10.4f cm max error %6.2fx %9.5f energy drift"), *Result.Name, Result.Steps, Result.NanosecondsPerStep, Result.StepsPerSecond, Result.MaxErrorCm, Result.Speedup, Result.EnergyDrift);
+        }
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+// Summary: Console command "Rope.Benchmark" running every scenario in the current process.
+static FAutoConsoleCommand GRopeBenchmarkCommand(
+    TEXT("Rope.Benchmark"),
+    TEXT("Runs rope simulation benchmarks and logs ns per step and steps per second."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        TArray<FRopeBenchmarkResult> Results;
+        RopeSimBenchmarks::RunAll(0, Results);
+        RopeSimBenchmarks::LogResults(Results);
+    }));
+#endif
@@ -0,0 +1,468 @@
+// Summary: Implements the UObject-free rope swing, tether, climb, and throw math.
+#include "Simulation/RopeSimCore.h"
+
+namespace RopeSimCore
+{
+    // Summary: Distance slack tolerated before the tether counts as tensioned.
+    constexpr float TetherTensionTolerance = 1.5f;
+
+    // Summary: Distance from full extension treated as fully paid out while climbing down.
+    constexpr float MaxExtensionTolerance = 0.5f;
+
+    // Summary: Upper bound of elastic segment compliance so a near-zero stiffness keeps the chain from going limp.
+    constexpr float MaxSegmentCompliance = 1.0f;
+
+    // Summary: Throw arc height as a fraction of throw distance.
+    constexpr float FlightArcHeightRatio = 0.25f;
+
+    // Summary: Minimum throw arc height in cm.
+    constexpr float FlightArcMinHeight = 120.0f;
+
+    // Summary: Maximum throw arc height in cm.
+    constexpr float FlightArcMaxHeight = 600.0f;
+
+    // Summary: Release launch speed along the swing direction in cm/s.
+    constexpr float ReleaseSwingSpeed = 200.0f;
+
+    // Summary: Release launch speed along the character forward axis in cm/s.
+    constexpr float ReleaseForwardSpeed = 200.0f;
+
+    // Summary: Height above the anchor the ledge probe starts at in cm.
+    constexpr float LedgeProbeLift = 20.0f;
+
+    // Summary: Length of the downward ledge probe in cm.
+    constexpr float LedgeProbeDepth = 200.0f;
+
+    // Summary: Minimum normal Z of a probe hit accepted as a walkable ledge regardless of the anchor normal.
+    constexpr float LedgeWalkableNormalZ = 0.55f;
+}
+
+#pragma region Methods
+#pragma region Hanging And Tether
+void FRopeSimCore::Step(const ERopeSimStepKind Kind, const FRopeSimParams& Params, const FRopeSimInput& Input, FRopeSimState& State)
+{
+    switch (Kind)
+    {
+    case ERopeSimStepKind::Hanging:
+        StepHanging(Params, Input, State);
+        break;
+    case ERopeSimStepKind::Tether:
+        StepTether(Params, Input, State);
+        break;
+    default:
+        break;
+    }
+}
+
+void FRopeSimCore::StepHanging(const FRopeSimParams& Params, const FRopeSimInput& Input, FRopeSimState& State)
+{
+    State.Location = Input.ActorLocation;
+    State.Velocity = Input.ActorVelocity;
+    State.Tension = 0.0f;
+    State.ConstraintImpulse = FVector::ZeroVector;
+
+    // Work in single precision relative to the anchor; only the final location goes back through world space.
+    const FVector3f RopeVector = MakeAnchorRelative(Input.AnchorLocation, Input.ActorLocation);
+    const float Distance = RopeVector.Size();
+
+    // Avoid division by zero when extremely close.
+    if (Distance <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    // Update current rope length based on climb input; a tap climbs for this step only.
+    if (State.ClimbInputSign == 0 && Input.ClimbTapSign != 0)
+    {
+        State.ClimbInputSign = Input.ClimbTapSign;
+        ApplyClimbLengthChange(Params, Input.DeltaTime, State);
+        State.ClimbInputSign = 0;
+    }
+    else
+    {
+        ApplyClimbLengthChange(Params, Input.DeltaTime, State);
+    }
+
+    const FVector3f RopeDir = RopeVector / Distance;
+    const FVector3f Gravity(Input.Gravity);
+    FVector3f Velocity(State.Velocity);
+    const FVector3f StartVelocity = Velocity;
+
+    // Build tangential acceleration from swing input relative to rope.
+    FVector3f TangentAccel = FVector3f(Input.ActorForward) * Input.SwingInput.Y + FVector3f(Input.ActorRight) * Input.SwingInput.X;
+    TangentAccel = TangentAccel - FVector3f::DotProduct(TangentAccel, RopeDir) * RopeDir;
+    const FVector3f TangentGravity = Gravity - FVector3f::DotProduct(Gravity, RopeDir) * RopeDir;
+
+    // A falling movement update owns gravity and the rope only adds its tangential part; a self-integrated character gets all of it here.
+    const FVector3f StepGravity = Input.bIntegrateActor ? Gravity : TangentGravity;
+    const FVector3f ExternalAccel = TangentAccel * Params.SwingAcceleration + StepGravity;
+
+    if (Params.bElastic)
+    {
+        Velocity += ExternalAccel * Input.DeltaTime;
+        StepElasticHanging(Params, Input, RopeDir, Distance, Velocity, State);
+    }
+    else if (Input.bIntegrateActor && Params.SwingIntegrator != ERopeSimIntegrator::Explicit)
+    {
+        StepConstrainedSwing(Params, Input, ExternalAccel, Velocity, State);
+    }
+    else
+    {
+        Velocity += ExternalAccel * Input.DeltaTime;
+        StepRigidHanging(Params, Input, RopeDir, Velocity, State);
+    }
+
+    // Whatever every integrator changed beyond the external acceleration is the rope's impulse; its inward part over the step is the tension.
+    const FVector3f ConstraintImpulse = Velocity - StartVelocity - ExternalAccel * Input.DeltaTime;
+    State.ConstraintImpulse = FVector(ConstraintImpulse);
+    State.Tension = Input.DeltaTime > KINDA_SMALL_NUMBER ? FMath::Max(-FVector3f::DotProduct(ConstraintImpulse, RopeDir), 0.0f) / Input.DeltaTime : 0.0f;
+
+    const float DampingScale = Input.SwingInput.IsNearlyZero() ? Params.SwingDamping * 2.0f : Params.SwingDamping;
+    Velocity *= FMath::Clamp(1.0f - DampingScale * Input.DeltaTime, 0.0f, 1.0f);
+    State.Velocity = FVector(Velocity);
+}
+
+void FRopeSimCore::StepTether(const FRopeSimParams& Params, const FRopeSimInput& Input, FRopeSimState& State)
+{
+    State.Location = Input.ActorLocation;
+    State.Velocity = Input.ActorVelocity;
+    State.bBeyondLength = false;
+    State.Tension = 0.0f;
+    State.ConstraintImpulse = FVector::ZeroVector;
+    State.RopeLength = FMath::Clamp(State.RopeLength, Params.ClimbMinLength, Params.MaxRopeLength);
+    const float FreeLength = GetFreeLength(Input, State);
+
+    const FVector3f RopeVector = MakeAnchorRelative(Input.AnchorLocation, Input.ActorLocation);
+    const float Distance = RopeVector.Size();
+
+    if (Distance <= KINDA_SMALL_NUMBER)
+    {
+        State.bTensioned = false;
+        return;
+    }
+
+    const FVector3f RopeDir = RopeVector / Distance;
+
+    // The ground tether always holds its length; walking movement already moved the character.
+    StepParticles(Params, Input, Input.ActorLocation, 0.0f, State);
+    State.Location = State.Particles.GetEndLocation();
+    State.bTensioned = State.Particles.IsEndTensioned();
+    State.bBeyondLength = Distance > FreeLength;
+
+    if (State.bBeyondLength)
+    {
+        const FVector3f Velocity(State.Velocity);
+        const FVector3f OutwardVelocity = FVector3f::DotProduct(Velocity, RopeDir) * RopeDir;
+        const float DampingAlpha = FMath::Clamp(1.0f - Params.SwingDamping * Input.DeltaTime, 0.0f, 1.0f);
+        State.Velocity = FVector((Velocity - OutwardVelocity) * DampingAlpha);
+        State.ConstraintImpulse = FVector(-OutwardVelocity);
+        State.Tension = Input.DeltaTime > KINDA_SMALL_NUMBER ? FMath::Max(FVector3f::DotProduct(Velocity, RopeDir), 0.0f) / Input.DeltaTime : 0.0f;
+    }
+    else
+    {
+        // Slack rope leaves the walking character where movement put it.
+        State.Location = Input.ActorLocation;
+    }
+
+    const float EffectiveDistance = State.bBeyondLength ? FreeLength : Distance;
+    State.bTensioned = State.bTensioned || EffectiveDistance >= FreeLength - RopeSimCore::TetherTensionTolerance;
+}
+
+void FRopeSimCore::StepRigidHanging(const FRopeSimParams& Params, const FRopeSimInput& Input, const FVector3f& RopeDir, FVector3f& Velocity, FRopeSimState& State)
+{
+    // The particle chain resolves rope length on the predicted end.
+    const FVector EndLocation = Input.bIntegrateActor ? Input.ActorLocation + FVector(Velocity * Input.DeltaTime) : Input.ActorLocation;
+    StepParticles(Params, Input, EndLocation, 0.0f, State);
+    State.Location = State.Particles.GetEndLocation();
+    State.bTensioned = State.Particles.IsEndTensioned();
+
+    // Strip velocity pulling away from the anchor only while the rope is taut so slack stays free.
+    if (State.bTensioned)
+    {
+        const float RadialSpeed = FVector3f::DotProduct(Velocity, RopeDir);
+
+        if (RadialSpeed > 0.0f)
+        {
+            Velocity -= RopeDir * RadialSpeed;
+        }
+    }
+}
+
+void FRopeSimCore::StepConstrainedSwing(const FRopeSimParams& Params, const FRopeSimInput& Input, const FVector3f& ExternalAccel, FVector3f& Velocity, FRopeSimState& State)
+{
+    const float FreeLength = GetFreeLength(Input, State);
+    FVector3f Offset = MakeAnchorRelative(Input.AnchorLocation, Input.ActorLocation);
+
+    if (Params.SwingIntegrator == ERopeSimIntegrator::RK4)
+    {
+        IntegrateRK4(ExternalAccel, FreeLength, Input.DeltaTime, Offset, Velocity);
+    }
+    else
+    {
+        IntegrateRattle(ExternalAccel, FreeLength, Input.DeltaTime, Offset, Velocity);
+    }
+
+    State.Location = Input.AnchorLocation + FVector(Offset);
+    State.bTensioned = Offset.Size() >= FreeLength - RopeSimCore::TetherTensionTolerance;
+
+    // The integrator already holds the rope length, so the chain only follows the character end.
+    StepParticles(Params, Input, State.Location, 0.0f, State);
+}
+
+void FRopeSimCore::IntegrateRattle(const FVector3f& ExternalAccel, const float Length, const float DeltaTime, FVector3f& Offset, FVector3f& Velocity)
+{
+    // Half kick, drift, then SHAKE the position back onto the rope if the drift overstretched it.
+    FVector3f HalfVelocity = Velocity + ExternalAccel * (0.5f * DeltaTime);
+    const FVector3f Drifted = Offset + HalfVelocity * DeltaTime;
+    FVector3f Solved = Drifted;
+    const bool bConstrained = Drifted.SizeSquared() > FMath::Square(Length);
+
+    if (bConstrained)
+    {
+        // Move along the old rope direction, the constraint gradient: |Drifted + Mu * Offset| = Length, smaller root.
+        const float A = Offset.SizeSquared();
+        const float B = FVector3f::DotProduct(Drifted, Offset);
+        const float C = Drifted.SizeSquared() - FMath::Square(Length);
+        const float Discriminant = B * B - A * C;
+
+        if (A > KINDA_SMALL_NUMBER && Discriminant >= 0.0f)
+        {
+            Solved = Drifted + Offset * ((FMath::Sqrt(Discriminant) - B) / A);
+        }
+        else
+        {
+            Solved = Drifted.GetSafeNormal() * Length;
+        }
+
+        HalfVelocity += (Solved - Drifted) / DeltaTime;
+    }
+
+    // Second half kick, then RATTLE removes the radial velocity so the next step starts on the constraint manifold.
+    Velocity = HalfVelocity + ExternalAccel * (0.5f * DeltaTime);
+    Offset = Solved;
+
+    if (bConstrained)
+    {
+        const FVector3f RopeDir = Solved.GetSafeNormal();
+        Velocity -= RopeDir * FVector3f::DotProduct(Velocity, RopeDir);
+    }
+}
+
+void FRopeSimCore::IntegrateRK4(const FVector3f& ExternalAccel, const float Length, const float DeltaTime, FVector3f& Offset, FVector3f& Velocity)
+{
+    // Tension is decided once per step; a slack rope integrates free flight.
+    const bool bTaut = Offset.Size() >= Length - RopeSimCore::TetherTensionTolerance;
+    const float HalfStep = 0.5f * DeltaTime;
+
+    const FVector3f K1Velocity = ComputeConstrainedAcceleration(ExternalAccel, Offset, Velocity, bTaut);
+    const FVector3f K1Offset = Velocity;
+    const FVector3f K2Velocity = ComputeConstrainedAcceleration(ExternalAccel, Offset + K1Offset * HalfStep, Velocity + K1Velocity * HalfStep, bTaut);
+    const FVector3f K2Offset = Velocity + K1Velocity * HalfStep;
+    const FVector3f K3Velocity = ComputeConstrainedAcceleration(ExternalAccel, Offset + K2Offset * HalfStep, Velocity + K2Velocity * HalfStep, bTaut);
+    const FVector3f K3Offset = Velocity + K2Velocity * HalfStep;
+    const FVector3f K4Velocity = ComputeConstrainedAcceleration(ExternalAccel, Offset + K3Offset * DeltaTime, Velocity + K3Velocity * DeltaTime, bTaut);
+    const FVector3f K4Offset = Velocity + K3Velocity * DeltaTime;
+
+    Offset += (K1Offset + K2Offset * 2.0f + K3Offset * 2.0f + K4Offset) * (DeltaTime / 6.0f);
+    Velocity += (K1Velocity + K2Velocity * 2.0f + K3Velocity * 2.0f + K4Velocity) * (DeltaTime / 6.0f);
+
+    // Remove the small truncation drift off the rope sphere, and catch a slack rope that ran out of length.
+    const float Distance = Offset.Size();
+
+    if (Distance > KINDA_SMALL_NUMBER && (bTaut || Distance > Length))
+    {
+        const FVector3f RopeDir = Offset / Distance;
+        Offset = RopeDir * FMath::Min(Distance, Length);
+        const float RadialSpeed = FVector3f::DotProduct(Velocity, RopeDir);
+
+        if (bTaut || RadialSpeed > 0.0f)
+        {
+            Velocity -= RopeDir * RadialSpeed;
+        }
+    }
+}
+
+FVector3f FRopeSimCore::ComputeConstrainedAcceleration(const FVector3f& ExternalAccel, const FVector3f& Offset, const FVector3f& Velocity, const bool bTaut)
+{
+    const float Distance = Offset.Size();
+
+    if (!bTaut || Distance <= KINDA_SMALL_NUMBER)
+    {
+        return ExternalAccel;
+    }
+
+    // Rope tension per unit mass: outward external pull plus the centripetal demand of the tangential speed. A rope cannot push.
+    const FVector3f RopeDir = Offset / Distance;
+    const FVector3f TangentVelocity = Velocity - RopeDir * FVector3f::DotProduct(Velocity, RopeDir);
+    const float Tension = FVector3f::DotProduct(ExternalAccel, RopeDir) + TangentVelocity.SizeSquared() / Distance;
+    return Tension > 0.0f ? ExternalAccel - RopeDir * Tension : ExternalAccel;
+}
+
+void FRopeSimCore::StepElasticHanging(const FRopeSimParams& Params, const FRopeSimInput& Input, const FVector3f& RopeDir, const float Distance, FVector3f& Velocity, FRopeSimState& State)
+{
+    const float FreeLength = GetFreeLength(Input, State);
+    const float Stretch = Distance - FreeLength;
+    const float StepTime = Input.DeltaTime;
+    const float Stiffness = FMath::Max(Params.ElasticStiffness, 0.0f);
+    const float Damping = FMath::Max(Params.ElasticDamping, 0.0f);
+
+    // Backward Euler on the stretch: v' = v - h (k s' + c v') with s' = s + h v'. Solving for v' gives a
+    // contraction for any stiffness and step, so gameplay stiffness needs no extra substeps. The rope only pulls.
+    if (Stretch > 0.0f)
+    {
+        const float RadialSpeed = FVector3f::DotProduct(Velocity, RopeDir);
+        const float SolvedRadialSpeed = (RadialSpeed - StepTime * Stiffness * Stretch) / (1.0f + StepTime * Damping + StepTime * StepTime * Stiffness);
+        Velocity += RopeDir * (SolvedRadialSpeed - RadialSpeed);
+    }
+
+    State.Location = Input.bIntegrateActor ? Input.ActorLocation + FVector(Velocity * StepTime) : Input.ActorLocation;
+    const float SolvedDistance = MakeAnchorRelative(Input.AnchorLocation, State.Location).Size();
+    State.bTensioned = SolvedDistance >= FreeLength - RopeSimCore::TetherTensionTolerance;
+
+    // The chain follows the character; segments in series share the spring's compliance so it stretches with it.
+    const int32 SegmentCount = FMath::Max(Params.ParticleCount, 2) - 1;
+    const float SegmentCompliance = Stiffness > KINDA_SMALL_NUMBER ? 1.0f / (Stiffness * SegmentCount) : RopeSimCore::MaxSegmentCompliance;
+    StepParticles(Params, Input, State.Location, FMath::Min(SegmentCompliance, RopeSimCore::MaxSegmentCompliance), State);
+}
+
+void FRopeSimCore::StepParticles(const FRopeSimParams& Params, const FRopeSimInput& Input, const FVector& EndLocation, const float Compliance, FRopeSimState& State)
+{
+    // Lazily rebuild the chain if hold began without it or the particle budget changed.
+    if (State.Particles.Num() != FMath::Max(Params.ParticleCount, 2))
+    {
+        State.Particles.Initialize(Input.AnchorLocation, Input.ActorLocation, Params.ParticleCount, GetFreeLength(Input, State), Params.CharacterInverseMass);
+    }
+
+    // The chain only spans the free segment; wrapped rope is laid along the pivots.
+    State.Particles.SetAnchorLocation(Input.AnchorLocation);
+    State.Particles.SetTotalRestLength(GetFreeLength(Input, State));
+    State.Particles.SetCompliance(Compliance);
+    State.Particles.SetEndLocation(EndLocation);
+    State.Particles.Step(Input.DeltaTime, Input.Gravity, Params.SolverIterations, Params.SwingDamping);
+}
+#pragma endregion Hanging And Tether
+
+#pragma region Climb
+void FRopeSimCore::ApplyClimbLengthChange(const FRopeSimParams& Params, const float DeltaTime, FRopeSimState& State)
+{
+    if (State.ClimbInputSign == 0)
+    {
+        return;
+    }
+
+    const bool bClimbingDown = State.ClimbInputSign < 0;
+    const bool bAtMaxExtension = State.RopeLength >= Params.MaxRopeLength - RopeSimCore::MaxExtensionTolerance;
+
+    if (bClimbingDown && bAtMaxExtension)
+    {
+        State.ClimbInputSign = 0;
+        State.RopeLength = Params.MaxRopeLength;
+        return;
+    }
+
+    const float TargetLength = State.RopeLength - State.ClimbInputSign * Params.ClimbSpeed * DeltaTime;
+    State.RopeLength = FMath::Clamp(TargetLength, Params.ClimbMinLength, Params.MaxRopeLength);
+
+    if (bClimbingDown && State.RopeLength >= Params.MaxRopeLength - RopeSimCore::MaxExtensionTolerance)
+    {
+        State.RopeLength = Params.MaxRopeLength;
+        State.ClimbInputSign = 0;
+    }
+}
+
+float FRopeSimCore::GetFreeLength(const FRopeSimInput& Input, const FRopeSimState& State)
+{
+    return FMath::Max(State.RopeLength - Input.WrappedLength, 0.0f);
+}
+
+FVector3f FRopeSimCore::MakeAnchorRelative(const FVector& AnchorLocation, const FVector& WorldLocation)
+{
+    // Subtract in double first; the offset is at most a rope length, so narrowing it keeps sub-millimeter precision anywhere in the world.
+    return FVector3f(WorldLocation - AnchorLocation);
+}
+
+FVector FRopeSimCore::RemoveRadialVelocity(const FVector& AnchorLocation, const FVector& ActorLocation, const FVector& Velocity)
+{
+    const FVector3f AnchorToActor = MakeAnchorRelative(AnchorLocation, ActorLocation);
+    const float Distance = AnchorToActor.Size();
+
+    if (Distance <= KINDA_SMALL_NUMBER)
+    {
+        return Velocity;
+    }
+
+    const FVector3f RopeDir = AnchorToActor / Distance;
+    const FVector3f LocalVelocity(Velocity);
+    return FVector(LocalVelocity - RopeDir * FVector3f::DotProduct(LocalVelocity, RopeDir));
+}
+#pragma endregion Climb
+
+#pragma region Wrapping
+FVector FRopeSimCore::ComputeWrapBendAxis(const FVector& PreviousPoint, const FVector& Pivot, const FVector& EndLocation)
+{
+    const FVector3f Incoming = MakeAnchorRelative(PreviousPoint, Pivot);
+    const FVector3f Outgoing = MakeAnchorRelative(Pivot, EndLocation);
+    return FVector(FVector3f::CrossProduct(Incoming, Outgoing).GetSafeNormal());
+}
+
+bool FRopeSimCore::IsWrapReversed(const FVector& PreviousPoint, const FVector& Pivot, const FVector& BendAxis, const FVector& EndLocation)
+{
+    // The bend keeps its sign while the rope stays wrapped and crosses zero exactly when both segments line up again.
+    const FVector3f Incoming = MakeAnchorRelative(PreviousPoint, Pivot);
+    const FVector3f Outgoing = MakeAnchorRelative(Pivot, EndLocation);
+    return FVector3f::DotProduct(FVector3f::CrossProduct(Incoming, Outgoing), FVector3f(BendAxis)) < 0.0f;
+}
+#pragma endregion Wrapping
+
+#pragma region Flight
+float FRopeSimCore::GetFlightAlpha(const float Elapsed, const float Duration)
+{
+    return Duration > KINDA_SMALL_NUMBER ? FMath::Clamp(Elapsed / Duration, 0.0f, 1.0f) : 1.0f;
+}
+
+FVector FRopeSimCore::EvaluateFlightArc(const FVector& Start, const FVector& Target, const float Alpha)
+{
+    const FVector FlatPosition = FMath::Lerp(Start, Target, Alpha);
+    const float Distance = FVector::Distance(Start, Target);
+    const float ArcHeight = FMath::Clamp(Distance * RopeSimCore::FlightArcHeightRatio, RopeSimCore::FlightArcMinHeight, RopeSimCore::FlightArcMaxHeight);
+    return FlatPosition + FVector::UpVector * (FMath::Sin(Alpha * PI) * ArcHeight);
+}
+
+FVector FRopeSimCore::GetReleaseLaunchVelocity(const FVector& SwingVelocity, const FVector& ActorForward)
+{
+    return SwingVelocity.GetSafeNormal() * RopeSimCore::ReleaseSwingSpeed + ActorForward * RopeSimCore::ReleaseForwardSpeed;
+}
+
+FVector FRopeSimCore::EvaluateBallisticArc(const FVector& Start, const FVector& Velocity, const FVector& Gravity, const float Time)
+{
+    return Start + Velocity * Time + Gravity * (0.5f * Time * Time);
+}
+#pragma endregion Flight
+
+#pragma region Ledge
+void FRopeSimCore::GetLedgeProbe(const FVector& AnchorLocation, const FVector& AnchorNormal, const float ProbeRadius, FVector& OutStart, FVector& OutEnd)
+{
+    OutStart = AnchorLocation + AnchorNormal * ProbeRadius + FVector::UpVector * RopeSimCore::LedgeProbeLift;
+    OutEnd = OutStart - FVector::UpVector * RopeSimCore::LedgeProbeDepth;
+}
+
+bool FRopeSimCore::IsValidLedgeNormal(const FVector& ImpactNormal, const FVector& AnchorNormal, const float NormalDotThreshold)
+{
+    return FVector::DotProduct(ImpactNormal, AnchorNormal) >= NormalDotThreshold || ImpactNormal.Z >= RopeSimCore::LedgeWalkableNormalZ;
+}
+
+FVector FRopeSimCore::GetLedgeStandLocation(const FVector& ImpactPoint, const FVector& AnchorNormal, const FVector& FallbackForward, const float StandOffDistance)
+{
+    FVector PlanarNormal = AnchorNormal;
+    PlanarNormal.Z = 0.0f;
+
+    if (PlanarNormal.IsNearlyZero())
+    {
+        PlanarNormal = FallbackForward;
+        PlanarNormal.Z = 0.0f;
+    }
+
+    return ImpactPoint - PlanarNormal.GetSafeNormal() * FMath::Max(StandOffDistance, 0.0f);
+}
+#pragma endregion Ledge
+#pragma endregion Methods
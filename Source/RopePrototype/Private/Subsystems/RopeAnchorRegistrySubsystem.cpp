@@ -0,0 +1,333 @@
+// Summary: Implements the grapple anchor hash grid and cone ranking for aim assist.
+#include "Subsystems/RopeAnchorRegistrySubsystem.h"
+
+#include "RopePrototype.h"
+#include "Components/BPC_RopeAnchorPointComponent.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Anchor Cone Query"), STAT_RopeAnchorConeQuery, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Anchors"), STAT_RopeAnchorsRegistered, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Anchor Cells Visited"), STAT_RopeAnchorCellsVisited, STATGROUP_Rope);
+
+namespace RopeAnchorRegistry
+{
+    // Summary: Grid cell edge in cm; a few anchors per cell in dense levels, few cells per slab for narrow cones.
+    constexpr float CellSize = 400.0f;
+
+    // Summary: Widest cone the query accepts; wider cones would visit most of the grid.
+    constexpr float MaxHalfAngleDegrees = 30.0f;
+}
+
+#pragma region Methods
+#pragma region Lifecycle
+void URopeAnchorRegistrySubsystem::Deinitialize()
+{
+    Entries.Empty();
+    Cells.Empty();
+    SET_DWORD_STAT(STAT_RopeAnchorsRegistered, 0);
+
+    Super::Deinitialize();
+}
+#pragma endregion Lifecycle
+
+#pragma region Registration
+int32 URopeAnchorRegistrySubsystem::RegisterAnchor(const UBPC_RopeAnchorPointComponent& Anchor)
+{
+    const int32 Handle = RegisterAnchor(MakeAnchorDesc(Anchor));
+    Entries[Handle].Component = &Anchor;
+    return Handle;
+}
+
+int32 URopeAnchorRegistrySubsystem::RegisterAnchor(const FRopeAnchorDesc& Desc)
+{
+    FAnchorEntry Entry;
+    Entry.Desc = Desc;
+    GetCellRange(Desc, Entry.MinCell, Entry.MaxCell);
+
+    const int32 Handle = Entries.Add(MoveTemp(Entry));
+    LinkEntry(Handle, true);
+    SET_DWORD_STAT(STAT_RopeAnchorsRegistered, Entries.Num());
+    return Handle;
+}
+
+void URopeAnchorRegistrySubsystem::UpdateAnchor(const int32 Handle)
+{
+    if (!Entries.IsValidIndex(Handle))
+    {
+        return;
+    }
+
+    if (const UBPC_RopeAnchorPointComponent* const Anchor = Entries[Handle].Component.Get())
+    {
+        SetEntryDesc(Handle, MakeAnchorDesc(*Anchor));
+    }
+}
+
+void URopeAnchorRegistrySubsystem::UpdateAnchor(const int32 Handle, const FRopeAnchorDesc& Desc)
+{
+    if (Entries.IsValidIndex(Handle))
+    {
+        SetEntryDesc(Handle, Desc);
+    }
+}
+
+void URopeAnchorRegistrySubsystem::UnregisterAnchor(const int32 Handle)
+{
+    if (!Entries.IsValidIndex(Handle))
+    {
+        return;
+    }
+
+    LinkEntry(Handle, false);
+    Entries.RemoveAt(Handle);
+    SET_DWORD_STAT(STAT_RopeAnchorsRegistered, Entries.Num());
+}
+
+int32 URopeAnchorRegistrySubsystem::GetNumAnchors() const
+{
+    return Entries.Num();
+}
+#pragma endregion Registration
+
+#pragma region Query
+bool URopeAnchorRegistrySubsystem::FindBestAnchorInCone(const FVector& Origin, const FVector& Direction, const float MaxDistance, const float HalfAngleDegrees, const float DistanceWeight, FRopeAnchorCandidate& OutCandidate)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeAnchorConeQuery);
+
+    const FVector Axis = Direction.GetSafeNormal();
+
+    if (Entries.Num() == 0 || Axis.IsNearlyZero() || MaxDistance <= KINDA_SMALL_NUMBER || HalfAngleDegrees <= KINDA_SMALL_NUMBER)
+    {
+        return false;
+    }
+
+    const float HalfAngle = FMath::DegreesToRadians(FMath::Min(HalfAngleDegrees, RopeAnchorRegistry::MaxHalfAngleDegrees));
+    const float TanHalfAngle = FMath::Tan(HalfAngle);
+    const FVector AxisEnd = Origin + Axis * MaxDistance;
+    const uint32 Stamp = ++QueryCounter;
+
+    bool bFound = false;
+    int32 CellsVisited = 0;
+
+    // Walk the axis one cell at a time; each slab is bounded by the cone's widest cross-section inside it.
+    const int32 SlabCount = FMath::CeilToInt32(MaxDistance / RopeAnchorRegistry::CellSize);
+
+    for (int32 SlabIndex = 0; SlabIndex < SlabCount; ++SlabIndex)
+    {
+        const float SlabNear = SlabIndex * RopeAnchorRegistry::CellSize;
+        const float SlabFar = FMath::Min(SlabNear + RopeAnchorRegistry::CellSize, MaxDistance);
+        const float SlabRadius = SlabFar * TanHalfAngle;
+
+        FBox SlabBox(ForceInit);
+        SlabBox += Origin + Axis * SlabNear;
+        SlabBox += Origin + Axis * SlabFar;
+        SlabBox = SlabBox.ExpandBy(SlabRadius);
+
+        FIntVector MinCell;
+        FIntVector MaxCell;
+        GetCellRange(SlabBox, MinCell, MaxCell);
+
+        for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+        {
+            for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+            {
+                for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+                {
+                    FAnchorCell* const Cell = Cells.Find(FIntVector(X, Y, Z));
+
+                    // Neighbouring slabs overlap by a cell; stamps keep each cell and anchor scored once.
+                    if (Cell == nullptr || Cell->QueryStamp == Stamp)
+                    {
+                        continue;
+                    }
+
+                    Cell->QueryStamp = Stamp;
+                    ++CellsVisited;
+
+                    for (const int32 Handle : Cell->Entries)
+                    {
+                        FAnchorEntry& Entry = Entries[Handle];
+
+                        if (Entry.QueryStamp == Stamp)
+                        {
+                            continue;
+                        }
+
+                        Entry.QueryStamp = Stamp;
+
+                        // Point on the span nearest the aim axis; for point anchors this is the anchor itself.
+                        FVector AxisPoint = FVector::ZeroVector;
+                        FVector AnchorPoint = FVector::ZeroVector;
+                        FMath::SegmentDistToSegmentSafe(Origin, AxisEnd, Entry.Desc.Start, Entry.Desc.End, AxisPoint, AnchorPoint);
+
+                        const FVector ToAnchor = AnchorPoint - Origin;
+                        const float Distance = ToAnchor.Size();
+
+                        if (Distance <= KINDA_SMALL_NUMBER || Distance > MaxDistance)
+                        {
+                            continue;
+                        }
+
+                        // The anchor radius subtends a wider angle up close, so thin beams stay easy to hit nearby.
+                        const float Offset = FMath::Acos(FMath::Clamp(FVector::DotProduct(ToAnchor / Distance, Axis), -1.0f, 1.0f));
+                        const float Slack = FMath::Atan2(Entry.Desc.Radius, Distance);
+
+                        if (Offset > HalfAngle + Slack)
+                        {
+                            continue;
+                        }
+
+                        const float Score = FMath::Max(Offset - Slack, 0.0f) / HalfAngle + DistanceWeight * Distance / MaxDistance;
+
+                        if (!bFound || Score < OutCandidate.Score)
+                        {
+                            bFound = true;
+                            OutCandidate.Location = AnchorPoint;
+                            OutCandidate.Normal = Entry.Desc.Normal;
+                            OutCandidate.Radius = Entry.Desc.Radius;
+                            OutCandidate.Owner = Entry.Desc.Owner;
+                            OutCandidate.Score = Score;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    INC_DWORD_STAT_BY(STAT_RopeAnchorCellsVisited, CellsVisited);
+    return bFound;
+}
+
+bool URopeAnchorRegistrySubsystem::FindBakedLedge(const FVector& AnchorLocation, const FVector& AnchorNormal, const float MaxDistance, const float NormalDotThreshold, FVector& OutStandLocation) const
+{
+    FIntVector MinCell;
+    FIntVector MaxCell;
+    GetCellRange(FBox(AnchorLocation - FVector(MaxDistance), AnchorLocation + FVector(MaxDistance)), MinCell, MaxCell);
+
+    float BestDistanceSquared = FMath::Square(MaxDistance);
+    bool bFound = false;
+
+    // The box spans a cell or two; an anchor listed in several of them is simply scored again.
+    for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+            {
+                const FAnchorCell* const Cell = Cells.Find(FIntVector(X, Y, Z));
+
+                if (Cell == nullptr)
+                {
+                    continue;
+                }
+
+                for (const int32 Handle : Cell->Entries)
+                {
+                    const FRopeAnchorDesc& Desc = Entries[Handle].Desc;
+
+                    if (!Desc.bHasLedge || FVector::DotProduct(Desc.Normal, AnchorNormal) < NormalDotThreshold)
+                    {
+                        continue;
+                    }
+
+                    const FVector SpanPoint = FMath::ClosestPointOnSegment(AnchorLocation, Desc.Start, Desc.End);
+                    const float DistanceSquared = FVector::DistSquared(SpanPoint, AnchorLocation);
+
+                    if (DistanceSquared <= BestDistanceSquared)
+                    {
+                        BestDistanceSquared = DistanceSquared;
+                        OutStandLocation = SpanPoint + Desc.LedgeOffset;
+                        bFound = true;
+                    }
+                }
+            }
+        }
+    }
+
+    return bFound;
+}
+#pragma endregion Query
+
+#pragma region Grid
+FRopeAnchorDesc URopeAnchorRegistrySubsystem::MakeAnchorDesc(const UBPC_RopeAnchorPointComponent& Anchor)
+{
+    FRopeAnchorDesc Desc;
+    Anchor.GetAnchorSegment(Desc.Start, Desc.End);
+    Desc.Normal = Anchor.GetAnchorNormal();
+    Desc.Radius = Anchor.GetAnchorRadius();
+    Desc.Owner = Anchor.GetOwner();
+    return Desc;
+}
+
+void URopeAnchorRegistrySubsystem::GetCellRange(const FRopeAnchorDesc& Desc, FIntVector& OutMin, FIntVector& OutMax)
+{
+    FBox Bounds(ForceInit);
+    Bounds += Desc.Start;
+    Bounds += Desc.End;
+    GetCellRange(Bounds.ExpandBy(Desc.Radius), OutMin, OutMax);
+}
+
+void URopeAnchorRegistrySubsystem::GetCellRange(const FBox& Bounds, FIntVector& OutMin, FIntVector& OutMax)
+{
+    OutMin = FIntVector(
+        FMath::FloorToInt32(Bounds.Min.X / RopeAnchorRegistry::CellSize),
+        FMath::FloorToInt32(Bounds.Min.Y / RopeAnchorRegistry::CellSize),
+        FMath::FloorToInt32(Bounds.Min.Z / RopeAnchorRegistry::CellSize));
+    OutMax = FIntVector(
+        FMath::FloorToInt32(Bounds.Max.X / RopeAnchorRegistry::CellSize),
+        FMath::FloorToInt32(Bounds.Max.Y / RopeAnchorRegistry::CellSize),
+        FMath::FloorToInt32(Bounds.Max.Z / RopeAnchorRegistry::CellSize));
+}
+
+void URopeAnchorRegistrySubsystem::LinkEntry(const int32 Handle, const bool bLink)
+{
+    const FAnchorEntry& Entry = Entries[Handle];
+
+    for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+    {
+        for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+        {
+            for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+            {
+                const FIntVector Key(X, Y, Z);
+
+                if (bLink)
+                {
+                    Cells.FindOrAdd(Key).Entries.Add(Handle);
+                }
+                else if (FAnchorCell* const Cell = Cells.Find(Key))
+                {
+                    Cell->Entries.RemoveSwap(Handle);
+
+                    if (Cell->Entries.Num() == 0)
+                    {
+                        Cells.Remove(Key);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void URopeAnchorRegistrySubsystem::SetEntryDesc(const int32 Handle, const FRopeAnchorDesc& Desc)
+{
+    FIntVector MinCell;
+    FIntVector MaxCell;
+    GetCellRange(Desc, MinCell, MaxCell);
+
+    FAnchorEntry& Entry = Entries[Handle];
+    Entry.Desc = Desc;
+
+    // Most moves stay inside the same cells; only a changed footprint touches the grid.
+    if (MinCell == Entry.MinCell && MaxCell == Entry.MaxCell)
+    {
+        return;
+    }
+
+    LinkEntry(Handle, false);
+    Entries[Handle].MinCell = MinCell;
+    Entries[Handle].MaxCell = MaxCell;
+    LinkEntry(Handle, true);
+}
+#pragma endregion Grid
+#pragma endregion Methods
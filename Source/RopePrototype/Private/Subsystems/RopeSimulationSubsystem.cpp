@@ -0,0 +1,492 @@
+// Summary: Implements batched rope ticking over packed simulation state.
+#include "Subsystems/RopeSimulationSubsystem.h"
+
+#include "RopePrototype.h"
+#include "Async/ParallelFor.h"
+#include "Components/BPC_RopeTraversalComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "PBDRigidsSolver.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "Simulation/RopeAsyncPhysics.h"
+#include "World/BPA_LooseRope.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rope Subsystem Tick"), STAT_RopeSubsystemTick, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Batched Core Step"), STAT_RopeBatchedCoreStep, STATGROUP_Rope);
+DECLARE_CYCLE_STAT(TEXT("Rope Significance Pass"), STAT_RopeSignificancePass, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Ropes"), STAT_RopeRegistered, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Ropes"), STAT_RopeActive, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rope Steps"), STAT_RopeSteps, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Thread Ropes"), STAT_RopeAsync, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sleeping Ropes"), STAT_RopeSleeping, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reduced Significance Ropes"), STAT_RopeReduced, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Kinematic Ropes"), STAT_RopeKinematic, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Awake Loose Ropes"), STAT_RopeLooseAwake, STATGROUP_Rope);
+
+namespace RopeSimulationSubsystem
+{
+    // Summary: Below this batch size the core step runs inline; task dispatch would cost more than the math.
+    constexpr int32 MinParallelBatch = 4;
+
+    // Summary: Seconds between significance passes; buckets change slowly and the pass walks every view.
+    constexpr float SignificanceInterval = 0.25f;
+
+    // Summary: Render tolerance in seconds for counting an owner as on screen.
+    constexpr float RecentlyRenderedTolerance = 0.2f;
+}
+
+#pragma region Methods
+#pragma region Lifecycle
+void URopeSimulationSubsystem::Deinitialize()
+{
+    ReleaseAsyncCallback();
+    Ropes.Reset();
+    States.Reset();
+    StepParams.Reset();
+    StepInputs.Reset();
+    StepKinds.Reset();
+    PendingSteps.Reset();
+    ActiveFlags.Reset();
+    RopeIds.Reset();
+    PendingAsyncRemovals.Reset();
+    BatchSlots.Reset();
+    DeferredRemovals.Reset();
+    AwakeLooseRopes.Reset();
+    NumActiveRopes = 0;
+
+    Super::Deinitialize();
+}
+
+void URopeSimulationSubsystem::Tick(const float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeSubsystemTick);
+    SET_DWORD_STAT(STAT_RopeRegistered, Ropes.Num());
+    SET_DWORD_STAT(STAT_RopeActive, NumActiveRopes);
+
+    // Dropped ropes settle independently of any character, so they run before the idle early out.
+    TickLooseRopes(DeltaTime);
+
+    if (NumActiveRopes == 0)
+    {
+        return;
+    }
+
+    // Ropes ending play mid-tick keep their slot until the pass finishes.
+    bIsTicking = true;
+    UpdateRopeSignificance(DeltaTime);
+
+    // Game-thread pass: aim, flight, and recall run inline; simulated ropes report owed fixed steps.
+    int32 MaxSteps = 0;
+    int32 NumSleepingRopes = 0;
+
+    for (int32 Slot = 0; Slot < Ropes.Num(); ++Slot)
+    {
+        PendingSteps[Slot] = 0;
+
+        if (!ActiveFlags[Slot] || Ropes[Slot] == nullptr)
+        {
+            continue;
+        }
+
+        PendingSteps[Slot] = Ropes[Slot]->BeginRopeFrame(DeltaTime);
+        MaxSteps = FMath::Max(MaxSteps, PendingSteps[Slot]);
+        NumSleepingRopes += Ropes[Slot]->IsRopeAsleep() ? 1 : 0;
+    }
+
+    SET_DWORD_STAT(STAT_RopeSleeping, NumSleepingRopes);
+
+    for (int32 StepIndex = 0; StepIndex < MaxSteps; ++StepIndex)
+    {
+        RunBatchedStep(StepIndex);
+    }
+
+    TickAsyncRopes();
+
+    for (int32 Slot = 0; Slot < Ropes.Num(); ++Slot)
+    {
+        if (ActiveFlags[Slot] && Ropes[Slot] != nullptr)
+        {
+            Ropes[Slot]->EndRopeFrame();
+        }
+    }
+
+    bIsTicking = false;
+    FlushDeferredRemovals();
+}
+
+void URopeSimulationSubsystem::UpdateRopeSignificance(const float DeltaTime)
+{
+    SignificanceAccumulator += DeltaTime;
+
+    if (SignificanceAccumulator < RopeSimulationSubsystem::SignificanceInterval)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_RopeSignificancePass);
+    SignificanceAccumulator = 0.0f;
+    SignificanceViews.Reset();
+
+    if (const UWorld* const World = GetWorld())
+    {
+        for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+        {
+            const APlayerController* const PlayerController = It->Get();
+
+            if (PlayerController == nullptr || !PlayerController->IsLocalController())
+            {
+                continue;
+            }
+
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            SignificanceViews.Add(ViewLocation);
+        }
+    }
+
+    int32 NumReduced = 0;
+    int32 NumKinematic = 0;
+
+    for (int32 Slot = 0; Slot < Ropes.Num(); ++Slot)
+    {
+        UBPC_RopeTraversalComponent* const Rope = Ropes[Slot];
+
+        if (!ActiveFlags[Slot] || Rope == nullptr)
+        {
+            continue;
+        }
+
+        // Without a local view (dedicated server) every rope keeps full fidelity.
+        float ViewDistance = 0.0f;
+        bool bRecentlyRendered = true;
+        const AActor* const Owner = Rope->GetOwner();
+
+        if (SignificanceViews.Num() > 0 && Owner != nullptr)
+        {
+            float MinDistanceSquared = TNumericLimits<float>::Max();
+
+            for (const FVector& ViewLocation : SignificanceViews)
+            {
+                MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared(ViewLocation, Owner->GetActorLocation())));
+            }
+
+            ViewDistance = FMath::Sqrt(MinDistanceSquared);
+            bRecentlyRendered = Owner->WasRecentlyRendered(RopeSimulationSubsystem::RecentlyRenderedTolerance);
+        }
+
+        Rope->UpdateRopeSignificance(ViewDistance, bRecentlyRendered);
+        NumReduced += Rope->GetRopeSignificance() != ERopeSignificance::Full ? 1 : 0;
+        NumKinematic += Rope->IsRopeKinematic() ? 1 : 0;
+    }
+
+    SET_DWORD_STAT(STAT_RopeReduced, NumReduced);
+    SET_DWORD_STAT(STAT_RopeKinematic, NumKinematic);
+}
+
+void URopeSimulationSubsystem::TickLooseRopes(const float DeltaTime)
+{
+    SET_DWORD_STAT(STAT_RopeLooseAwake, AwakeLooseRopes.Num());
+
+    if (AwakeLooseRopes.Num() == 0)
+    {
+        return;
+    }
+
+    // Each rope sweeps the world for its own particles, so the pass stays on the game thread.
+    bIsTickingLooseRopes = true;
+
+    for (int32 Index = 0; Index < AwakeLooseRopes.Num(); ++Index)
+    {
+        ABPA_LooseRope* const LooseRope = AwakeLooseRopes[Index];
+
+        if (LooseRope != nullptr && !LooseRope->TickLooseRope(DeltaTime))
+        {
+            AwakeLooseRopes[Index] = nullptr;
+        }
+    }
+
+    bIsTickingLooseRopes = false;
+    AwakeLooseRopes.RemoveAllSwap([](const TObjectPtr<ABPA_LooseRope>& LooseRope) { return LooseRope == nullptr; }, EAllowShrinking::No);
+}
+
+void URopeSimulationSubsystem::RunBatchedStep(const int32 StepIndex)
+{
+    BatchSlots.Reset();
+
+    // Gather inputs on the game thread; ropes may leave simulation between steps.
+    for (int32 Slot = 0; Slot < Ropes.Num(); ++Slot)
+    {
+        if (PendingSteps[Slot] <= StepIndex || Ropes[Slot] == nullptr)
+        {
+            continue;
+        }
+
+        if (Ropes[Slot]->PrepareRopeStep(StepParams[Slot], StepInputs[Slot], StepKinds[Slot]))
+        {
+            BatchSlots.Add(Slot);
+        }
+    }
+
+    INC_DWORD_STAT_BY(STAT_RopeSteps, BatchSlots.Num());
+
+    // Pure math for every rope in one pass over the packed arrays.
+    {
+        SCOPE_CYCLE_COUNTER(STAT_RopeBatchedCoreStep);
+        const EParallelForFlags Flags = BatchSlots.Num() < RopeSimulationSubsystem::MinParallelBatch ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+        ParallelFor(BatchSlots.Num(), [this](const int32 BatchIndex)
+        {
+            const int32 Slot = BatchSlots[BatchIndex];
+            FRopeSimCore::Step(StepKinds[Slot], StepParams[Slot], StepInputs[Slot], States[Slot]);
+        }, Flags);
+    }
+
+    // Movement and collision go back through the game thread.
+    for (const int32 Slot : BatchSlots)
+    {
+        if (Ropes[Slot] != nullptr)
+        {
+            Ropes[Slot]->ApplyRopeStep(StepKinds[Slot]);
+        }
+    }
+}
+
+void URopeSimulationSubsystem::FlushDeferredRemovals()
+{
+    // Highest slot first so every swap pulls in a rope that is still registered.
+    DeferredRemovals.Sort(TGreater<int32>());
+
+    for (const int32 Slot : DeferredRemovals)
+    {
+        UnregisterRope(Slot);
+    }
+
+    DeferredRemovals.Reset();
+}
+
+void URopeSimulationSubsystem::TickAsyncRopes()
+{
+    bool bAnyAsyncRope = false;
+
+    for (int32 Slot = 0; Slot < Ropes.Num() && !bAnyAsyncRope; ++Slot)
+    {
+        bAnyAsyncRope = ActiveFlags[Slot] && Ropes[Slot] != nullptr && Ropes[Slot]->IsSimulatedOnPhysicsThread();
+    }
+
+    if (!bAnyAsyncRope && AsyncCallback == nullptr)
+    {
+        return;
+    }
+
+    if (!EnsureAsyncCallback())
+    {
+        return;
+    }
+
+    // Physics may have stepped several times since last frame; only the newest result per rope matters.
+    TMap<int32, FRopeAsyncRopeOutput> LatestOutputs;
+
+    while (Chaos::TSimCallbackOutputHandle<FRopeAsyncOutput> AsyncOutput = AsyncCallback->PopOutputData_External())
+    {
+        for (FRopeAsyncRopeOutput& RopeOutput : AsyncOutput->Ropes)
+        {
+            LatestOutputs.Add(RopeOutput.RopeId, MoveTemp(RopeOutput));
+        }
+    }
+
+    // Inputs stay with the producer until physics consumes them, so rebuild rather than append.
+    FRopeAsyncInput* const AsyncInput = AsyncCallback->GetProducerInputData_External();
+    AsyncInput->Ropes.Reset();
+    AsyncInput->RemovedRopeIds.Append(PendingAsyncRemovals);
+    PendingAsyncRemovals.Reset();
+    AsyncSerial = AsyncSerial == MAX_uint32 ? 1 : AsyncSerial + 1;
+    AsyncInput->Serial = AsyncSerial;
+
+    for (int32 Slot = 0; Slot < Ropes.Num(); ++Slot)
+    {
+        UBPC_RopeTraversalComponent* const Rope = Ropes[Slot];
+
+        if (!ActiveFlags[Slot] || Rope == nullptr || !Rope->IsSimulatedOnPhysicsThread())
+        {
+            continue;
+        }
+
+        if (const FRopeAsyncRopeOutput* const RopeOutput = LatestOutputs.Find(RopeIds[Slot]))
+        {
+            Rope->ApplyAsyncRopeOutput(*RopeOutput);
+        }
+
+        // Applying results can end the hang or tether; check again before pushing new input.
+        if (!ActiveFlags[Slot] || Ropes[Slot] == nullptr || !Rope->IsSimulatedOnPhysicsThread())
+        {
+            continue;
+        }
+
+        FRopeAsyncRopeInput& RopeInput = AsyncInput->Ropes.AddDefaulted_GetRef();
+        RopeInput.RopeId = RopeIds[Slot];
+
+        if (!Rope->PrepareAsyncRopeInput(RopeInput))
+        {
+            AsyncInput->Ropes.Pop(EAllowShrinking::No);
+        }
+    }
+
+    SET_DWORD_STAT(STAT_RopeAsync, AsyncInput->Ropes.Num());
+}
+
+bool URopeSimulationSubsystem::EnsureAsyncCallback()
+{
+    if (AsyncCallback != nullptr)
+    {
+        return true;
+    }
+
+    UWorld* const World = GetWorld();
+    FPhysScene* const PhysScene = World != nullptr ? World->GetPhysicsScene() : nullptr;
+    Chaos::FPhysicsSolver* const Solver = PhysScene != nullptr ? PhysScene->GetSolver() : nullptr;
+
+    if (Solver == nullptr)
+    {
+        return false;
+    }
+
+    AsyncCallback = Solver->CreateAndRegisterSimCallbackObject_External<FRopeAsyncSimCallback>();
+    return AsyncCallback != nullptr;
+}
+
+void URopeSimulationSubsystem::ReleaseAsyncCallback()
+{
+    if (AsyncCallback == nullptr)
+    {
+        return;
+    }
+
+    UWorld* const World = GetWorld();
+    FPhysScene* const PhysScene = World != nullptr ? World->GetPhysicsScene() : nullptr;
+
+    if (Chaos::FPhysicsSolver* const Solver = PhysScene != nullptr ? PhysScene->GetSolver() : nullptr)
+    {
+        Solver->UnregisterAndFreeSimCallbackObject_External(AsyncCallback);
+    }
+
+    AsyncCallback = nullptr;
+}
+
+TStatId URopeSimulationSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(URopeSimulationSubsystem, STATGROUP_Tickables);
+}
+#pragma endregion Lifecycle
+
+#pragma region Registration
+int32 URopeSimulationSubsystem::RegisterRope(UBPC_RopeTraversalComponent& Rope)
+{
+    const int32 Slot = Ropes.Add(&Rope);
+    RopeIds.Add(NextRopeId++);
+    States.AddDefaulted();
+    StepParams.AddDefaulted();
+    StepInputs.AddDefaulted();
+    StepKinds.Add(ERopeSimStepKind::None);
+    PendingSteps.Add(0);
+    ActiveFlags.Add(false);
+    return Slot;
+}
+
+void URopeSimulationSubsystem::UnregisterRope(const int32 Slot)
+{
+    if (!IsValidSlot(Slot))
+    {
+        return;
+    }
+
+    SetRopeActive(Slot, false);
+
+    if (bIsTicking)
+    {
+        Ropes[Slot] = nullptr;
+        DeferredRemovals.AddUnique(Slot);
+        return;
+    }
+
+    PendingAsyncRemovals.Add(RopeIds[Slot]);
+    Ropes.RemoveAtSwap(Slot);
+    RopeIds.RemoveAtSwap(Slot);
+    States.RemoveAtSwap(Slot);
+    StepParams.RemoveAtSwap(Slot);
+    StepInputs.RemoveAtSwap(Slot);
+    StepKinds.RemoveAtSwap(Slot);
+    PendingSteps.RemoveAtSwap(Slot);
+    ActiveFlags.RemoveAtSwap(Slot);
+
+    // Tell the rope that moved into the freed slot where its state now lives.
+    if (Ropes.IsValidIndex(Slot) && Ropes[Slot] != nullptr)
+    {
+        Ropes[Slot]->SetSimulationSlot(Slot);
+    }
+}
+
+void URopeSimulationSubsystem::SetRopeActive(const int32 Slot, const bool bActive)
+{
+    if (!IsValidSlot(Slot) || ActiveFlags[Slot] == bActive)
+    {
+        return;
+    }
+
+    ActiveFlags[Slot] = bActive;
+    NumActiveRopes += bActive ? 1 : -1;
+}
+
+bool URopeSimulationSubsystem::IsValidSlot(const int32 Slot) const
+{
+    return Ropes.IsValidIndex(Slot);
+}
+
+FRopeSimState& URopeSimulationSubsystem::GetState(const int32 Slot)
+{
+    check(IsValidSlot(Slot));
+    return States[Slot];
+}
+
+const FRopeSimState& URopeSimulationSubsystem::GetState(const int32 Slot) const
+{
+    check(IsValidSlot(Slot));
+    return States[Slot];
+}
+
+int32 URopeSimulationSubsystem::GetNumRopes() const
+{
+    return Ropes.Num();
+}
+
+int32 URopeSimulationSubsystem::GetNumActiveRopes() const
+{
+    return NumActiveRopes;
+}
+
+void URopeSimulationSubsystem::SetLooseRopeAwake(ABPA_LooseRope& LooseRope, const bool bAwake)
+{
+    if (bAwake)
+    {
+        AwakeLooseRopes.AddUnique(&LooseRope);
+        return;
+    }
+
+    const int32 Index = AwakeLooseRopes.Find(&LooseRope);
+
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    // Mid-pass removals only clear the entry; the pass compacts the list once it finishes.
+    if (bIsTickingLooseRopes)
+    {
+        AwakeLooseRopes[Index] = nullptr;
+        return;
+    }
+
+    AwakeLooseRopes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+#pragma endregion Registration
+#pragma endregion Methods
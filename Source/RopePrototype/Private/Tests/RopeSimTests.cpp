@@ -0,0 +1,89 @@
+// Summary: Automation tests for the rope simulation, run with "Automation RunTests Rope".
+#include "Misc/AutomationTest.h"
+#include "Simulation/RopeSimBenchmarks.h"
+#include "Simulation/RopeSimCore.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RopeSimTests
+{
+    // Summary: Steps per test; ten simulated seconds at the benchmark rate.
+    constexpr int32 TestSteps = 600;
+
+    // Summary: Flags shared by rope tests; pure simulation runs in any context, including -nullrhi.
+    constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+    // Summary: Reports a core benchmark result and checks that every step ran and was timed.
+    bool CheckBenchmark(FAutomationTestBase& Test, const FRopeBenchmarkResult& Result)
+    {
+        Test.AddInfo(FString::Printf(TEXT("%s: %d steps, %.1f ns/step, %.0f steps/s"), *Result.Name, Result.Steps, Result.NanosecondsPerStep, Result.StepsPerSecond));
+        Test.TestEqual(*FString::Printf(TEXT("%s step count"), *Result.Name), Result.Steps, RopeSimBenchmarks::DefaultSteps);
+        Test.TestTrue(*FString::Printf(TEXT("%s step cost is finite"), *Result.Name), FMath::IsFinite(Result.NanosecondsPerStep) && Result.NanosecondsPerStep >= 0.0);
+        return !Test.HasAnyErrors();
+    }
+
+    // Summary: Checks that the character never ended up further from the pivot than the rope is long.
+    bool CheckStretch(FAutomationTestBase& Test, const FRopeBenchmarkResult& Result)
+    {
+        Test.TestTrue(*FString::Printf(TEXT("%s stays within %.1f cm of rope length (stretch %.3f cm)"), *Result.Name, RopeSimBenchmarks::CoreStretchToleranceCm, Result.MaxErrorCm),
+            FMath::IsFinite(Result.MaxErrorCm) && Result.MaxErrorCm <= RopeSimBenchmarks::CoreStretchToleranceCm);
+        return !Test.HasAnyErrors();
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRopeKernelVectorMatchesScalarTest, "Rope.Kernel.VectorMatchesScalar", RopeSimTests::TestFlags)
+
+bool FRopeKernelVectorMatchesScalarTest::RunTest(const FString& Parameters)
+{
+    for (const int32 ParticleCount : {8, 32, 128})
+    {
+        TArray<FRopeBenchmarkResult> Results;
+        RopeSimBenchmarks::RunParticleSolverKernels(ParticleCount, RopeSimTests::TestSteps, Results);
+
+        if (!TestEqual(TEXT("Kernel scenario results"), Results.Num(), 2))
+        {
+            return false;
+        }
+
+        const FRopeBenchmarkResult& VectorResult = Results.Last();
+        TestTrue(FString::Printf(TEXT("Vector kernel stays within %.2f cm of the scalar path with %d particles (drift %.5f cm)"), RopeSimBenchmarks::KernelToleranceCm, ParticleCount, VectorResult.MaxErrorCm), VectorResult.MaxErrorCm <= RopeSimBenchmarks::KernelToleranceCm);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRopeBenchSwingTest, "Rope.Bench.Swing", RopeSimTests::TestFlags)
+
+bool FRopeBenchSwingTest::RunTest(const FString& Parameters)
+{
+    const FRopeBenchmarkResult Result = RopeSimBenchmarks::RunSwing(RopeSimBenchmarks::DefaultSteps);
+    return RopeSimTests::CheckBenchmark(*this, Result) && RopeSimTests::CheckStretch(*this, Result);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRopeBenchTetherTest, "Rope.Bench.Tether", RopeSimTests::TestFlags)
+
+bool FRopeBenchTetherTest::RunTest(const FString& Parameters)
+{
+    const FRopeBenchmarkResult Result = RopeSimBenchmarks::RunTether(RopeSimBenchmarks::DefaultSteps);
+    return RopeSimTests::CheckBenchmark(*this, Result) && RopeSimTests::CheckStretch(*this, Result);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRopeBenchClimbTest, "Rope.Bench.Climb", RopeSimTests::TestFlags)
+
+bool FRopeBenchClimbTest::RunTest(const FString& Parameters)
+{
+    const FRopeBenchmarkResult Result = RopeSimBenchmarks::RunClimb(RopeSimBenchmarks::DefaultSteps);
+    if (!RopeSimTests::CheckBenchmark(*this, Result) || !RopeSimTests::CheckStretch(*this, Result))
+    {
+        return false;
+    }
+
+    // Climbing must stop exactly at both clamps: reaching them proves the phases are long enough, not passing them proves the clamp.
+    const double MinLength = RopeSimBenchmarks::ClimbBenchmarkMinLength;
+    const double MaxLength = FRopeSimParams().MaxRopeLength;
+    TestTrue(FString::Printf(TEXT("Climb reaches the %.0f cm minimum without passing it (shortest %.3f cm)"), MinLength, Result.MinRopeLength), FMath::IsNearlyEqual(Result.MinRopeLength, MinLength, UE_KINDA_SMALL_NUMBER));
+    TestTrue(FString::Printf(TEXT("Climb reaches the %.0f cm maximum without passing it (longest %.3f cm)"), MaxLength, Result.MaxRopeLength), FMath::IsNearlyEqual(Result.MaxRopeLength, MaxLength, UE_KINDA_SMALL_NUMBER));
+    return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,417 @@
+// Summary: Implements settling, sleeping, and pickup offers for dropped ropes.
+#include "World/BPA_LooseRope.h"
+
+#include "RopePrototype.h"
+#include "Components/BPC_RopeTraversalComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/SplineMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInterface.h"
+#include "Subsystems/RopeSimulationSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Loose Rope Step"), STAT_RopeLooseStep, STATGROUP_Rope);
+
+namespace LooseRope
+{
+    // Summary: Most settling steps run in one frame; a hitch drops time instead of spiraling.
+    constexpr int32 MaxStepsPerFrame = 4;
+
+    // Summary: Contact normals at least this upright count as ground and apply friction.
+    constexpr float GroundNormalZ = 0.5f;
+}
+
+#pragma region Methods
+#pragma region Lifecycle
+ABPA_LooseRope::ABPA_LooseRope()
+{
+    // The simulation subsystem steps awake ropes; sleeping ropes must not cost a tick.
+    PrimaryActorTick.bCanEverTick = false;
+
+    AnchorRoot = CreateDefaultSubobject<USceneComponent>(TEXT("AnchorRoot"));
+    AnchorRoot->SetMobility(EComponentMobility::Movable);
+    SetRootComponent(AnchorRoot);
+
+    DisturbSphere = CreateDefaultSubobject<USphereComponent>(TEXT("DisturbSphere"));
+    DisturbSphere->SetupAttachment(AnchorRoot);
+    DisturbSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    DisturbSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+    DisturbSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+    DisturbSphere->SetCollisionResponseToChannel(ECC_PhysicsBody, ECR_Overlap);
+    DisturbSphere->SetGenerateOverlapEvents(true);
+    DisturbSphere->SetCanEverAffectNavigation(false);
+
+    RopeMesh = nullptr;
+    RopeMeshMaterial = nullptr;
+    RopeRadius = 1.0f;
+    ParticleCount = 16;
+    SolverIterations = 8;
+    StepRate = 60.0f;
+    Damping = 1.5f;
+    GroundFriction = 0.2f;
+    CollisionRadius = 4.0f;
+    SleepSpeedThreshold = 3.0f;
+    SleepStepsRequired = 20;
+    MaxAwakeSeconds = 4.0f;
+    GrabRadius = 140.0f;
+
+    AnchorNormal = FVector::UpVector;
+    RopeLength = 0.0f;
+    StepAccumulator = 0.0f;
+    QuietSteps = 0;
+    AwakeSeconds = 0.0f;
+    bLooseRopeAsleep = true;
+}
+
+void ABPA_LooseRope::BeginPlay()
+{
+    Super::BeginPlay();
+
+    DisturbSphere->OnComponentBeginOverlap.AddDynamic(this, &ABPA_LooseRope::HandleDisturbBeginOverlap);
+    DisturbSphere->OnComponentEndOverlap.AddDynamic(this, &ABPA_LooseRope::HandleDisturbEndOverlap);
+}
+
+void ABPA_LooseRope::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* const World = GetWorld())
+    {
+        if (URopeSimulationSubsystem* const Subsystem = World->GetSubsystem<URopeSimulationSubsystem>())
+        {
+            Subsystem->SetLooseRopeAwake(*this, false);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+#pragma endregion Lifecycle
+
+#pragma region Simulation
+void ABPA_LooseRope::InitializeFromDrop(const FVector& InAnchorNormal, const TArray<FVector>& RopePath, const float InRopeLength)
+{
+    if (RopePath.Num() < 2)
+    {
+        return;
+    }
+
+    AnchorNormal = InAnchorNormal.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+    RopeLength = FMath::Max(InRopeLength, 1.0f);
+
+    // The actor stays unrotated at the anchor, so solver-local positions double as component-relative ones.
+    SetActorLocationAndRotation(RopePath[0], FRotator::ZeroRotator);
+
+    const int32 Count = FMath::Clamp(ParticleCount, 2, 64);
+    Particles.Initialize(RopePath[0], RopePath.Last(), Count, RopeLength, 1.0f);
+    Particles.SetFreeEnd(true);
+
+    // Resample the dropped path evenly by arc length so the chain starts where the rope was drawn.
+    float PathLength = 0.0f;
+
+    for (int32 Index = 1; Index < RopePath.Num(); ++Index)
+    {
+        PathLength += static_cast<float>(FVector::Dist(RopePath[Index - 1], RopePath[Index]));
+    }
+
+    TArray<FVector3f> Resampled;
+    Resampled.SetNumUninitialized(Count);
+    int32 PathSegment = 1;
+    float PathWalked = 0.0f;
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const float Target = PathLength * static_cast<float>(Index) / static_cast<float>(Count - 1);
+
+        while (PathSegment < RopePath.Num() - 1 && PathWalked + FVector::Dist(RopePath[PathSegment - 1], RopePath[PathSegment]) < Target)
+        {
+            PathWalked += static_cast<float>(FVector::Dist(RopePath[PathSegment - 1], RopePath[PathSegment]));
+            ++PathSegment;
+        }
+
+        const float SegmentLength = static_cast<float>(FVector::Dist(RopePath[PathSegment - 1], RopePath[PathSegment]));
+        const float Alpha = SegmentLength > KINDA_SMALL_NUMBER ? FMath::Clamp((Target - PathWalked) / SegmentLength, 0.0f, 1.0f) : 0.0f;
+        Resampled[Index] = FVector3f(FMath::Lerp(RopePath[PathSegment - 1], RopePath[PathSegment], Alpha) - RopePath[0]);
+    }
+
+    // Applied twice so previous positions match and the chain starts at rest.
+    Particles.SetLocalPositions(RopePath[0], Resampled);
+    Particles.SetLocalPositions(RopePath[0], Resampled);
+
+    UpdateRopeVisual();
+    FitDisturbSphere();
+    WakeLooseRope();
+}
+
+bool ABPA_LooseRope::TickLooseRope(const float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RopeLooseStep);
+
+    if (bLooseRopeAsleep || !Particles.IsInitialized())
+    {
+        return false;
+    }
+
+    UWorld* const World = GetWorld();
+
+    if (World == nullptr)
+    {
+        return false;
+    }
+
+    const float StepTime = 1.0f / FMath::Max(StepRate, 1.0f);
+    StepAccumulator = FMath::Min(StepAccumulator + DeltaTime, StepTime * LooseRope::MaxStepsPerFrame);
+    AwakeSeconds += DeltaTime;
+
+    const FVector Gravity(0.0f, 0.0f, World->GetGravityZ());
+    const float SleepStepDistance = SleepSpeedThreshold * StepTime;
+    bool bStepped = false;
+
+    while (StepAccumulator >= StepTime)
+    {
+        StepAccumulator -= StepTime;
+        Particles.Step(StepTime, Gravity, SolverIterations, Damping);
+        ResolveParticleCollisions();
+        bStepped = true;
+
+        // Settled once no particle moved faster than the threshold for enough consecutive steps.
+        const TArray<FVector3f>& Positions = Particles.GetLocalPositions();
+        const TArray<FVector3f>& PreviousPositions = Particles.GetLocalPreviousPositions();
+        float MaxStepDistanceSquared = 0.0f;
+
+        for (int32 Index = 1; Index < Positions.Num(); ++Index)
+        {
+            MaxStepDistanceSquared = FMath::Max(MaxStepDistanceSquared, FVector3f::DistSquared(Positions[Index], PreviousPositions[Index]));
+        }
+
+        QuietSteps = MaxStepDistanceSquared <= FMath::Square(SleepStepDistance) ? QuietSteps + 1 : 0;
+    }
+
+    if (bStepped)
+    {
+        UpdateRopeVisual();
+    }
+
+    if (QuietSteps >= SleepStepsRequired || AwakeSeconds >= MaxAwakeSeconds)
+    {
+        PutLooseRopeToSleep();
+        return false;
+    }
+
+    return true;
+}
+
+void ABPA_LooseRope::WakeLooseRope()
+{
+    QuietSteps = 0;
+    AwakeSeconds = 0.0f;
+
+    if (!bLooseRopeAsleep || !Particles.IsInitialized())
+    {
+        return;
+    }
+
+    bLooseRopeAsleep = false;
+    StepAccumulator = 0.0f;
+
+    if (UWorld* const World = GetWorld())
+    {
+        if (URopeSimulationSubsystem* const Subsystem = World->GetSubsystem<URopeSimulationSubsystem>())
+        {
+            Subsystem->SetLooseRopeAwake(*this, true);
+        }
+    }
+}
+
+bool ABPA_LooseRope::IsLooseRopeAsleep() const
+{
+    return bLooseRopeAsleep;
+}
+
+void ABPA_LooseRope::ResolveParticleCollisions()
+{
+    UWorld* const World = GetWorld();
+
+    if (World == nullptr || CollisionRadius <= 0.0f)
+    {
+        return;
+    }
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(LooseRopeParticleSweep), false, this);
+    const FCollisionShape Shape = FCollisionShape::MakeSphere(CollisionRadius);
+    const FVector& Origin = Particles.GetOrigin();
+    TArray<FVector3f>& Positions = Particles.GetMutableLocalPositions();
+    const TArray<FVector3f>& PreviousPositions = Particles.GetLocalPreviousPositions();
+    const float SlideKeep = FMath::Clamp(GroundFriction, 0.0f, 1.0f);
+
+    // Unlike a held rope the free end collides too; only the anchor stays pinned to its surface.
+    for (int32 Index = 1; Index < Positions.Num(); ++Index)
+    {
+        const FVector SweepStart = Origin + FVector(PreviousPositions[Index]);
+        const FVector SweepEnd = Origin + FVector(Positions[Index]);
+        FHitResult Hit;
+
+        if (!World->SweepSingleByChannel(Hit, SweepStart, SweepEnd, FQuat::Identity, ECC_Visibility, Shape, Params))
+        {
+            continue;
+        }
+
+        FVector Resolved = Hit.bStartPenetrating ? SweepEnd + Hit.Normal * (Hit.PenetrationDepth + KINDA_SMALL_NUMBER) : Hit.Location;
+
+        // Ground contacts give up part of their slide this step, which is what lets a coil come to rest.
+        if (Hit.Normal.Z >= LooseRope::GroundNormalZ)
+        {
+            const FVector Slide = FVector::VectorPlaneProject(Resolved - SweepStart, Hit.Normal);
+            Resolved -= Slide * (1.0f - SlideKeep);
+        }
+
+        Positions[Index] = FVector3f(Resolved - Origin);
+    }
+}
+
+void ABPA_LooseRope::PutLooseRopeToSleep()
+{
+    bLooseRopeAsleep = true;
+    StepAccumulator = 0.0f;
+    FitDisturbSphere();
+
+    if (UWorld* const World = GetWorld())
+    {
+        if (URopeSimulationSubsystem* const Subsystem = World->GetSubsystem<URopeSimulationSubsystem>())
+        {
+            Subsystem->SetLooseRopeAwake(*this, false);
+        }
+    }
+}
+
+void ABPA_LooseRope::FitDisturbSphere()
+{
+    if (!Particles.IsInitialized())
+    {
+        return;
+    }
+
+    const FBox3f Bounds(Particles.GetLocalPositions());
+    FVector3f Center;
+    FVector3f Extent;
+    Bounds.GetCenterAndExtents(Center, Extent);
+
+    DisturbSphere->SetRelativeLocation(FVector(Center));
+    DisturbSphere->SetSphereRadius(Extent.Size() + GrabRadius);
+}
+
+void ABPA_LooseRope::UpdateRopeVisual()
+{
+    const TArray<FVector3f>& Positions = Particles.GetLocalPositions();
+    const int32 SegmentCount = Positions.Num() - 1;
+
+    if (RopeMesh == nullptr || SegmentCount <= 0)
+    {
+        return;
+    }
+
+    while (RopeMeshPool.Num() < SegmentCount)
+    {
+        USplineMeshComponent* const NewMesh = NewObject<USplineMeshComponent>(this);
+
+        if (NewMesh == nullptr)
+        {
+            return;
+        }
+
+        NewMesh->SetMobility(EComponentMobility::Movable);
+        NewMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        NewMesh->SetCastShadow(false);
+        NewMesh->SetForwardAxis(ESplineMeshAxis::X);
+        NewMesh->SetStaticMesh(RopeMesh);
+
+        if (RopeMeshMaterial != nullptr)
+        {
+            NewMesh->SetMaterial(0, RopeMeshMaterial);
+        }
+
+        NewMesh->SetStartScale(FVector2D(RopeRadius, RopeRadius));
+        NewMesh->SetEndScale(FVector2D(RopeRadius, RopeRadius));
+        NewMesh->AttachToComponent(AnchorRoot, FAttachmentTransformRules::KeepRelativeTransform);
+        NewMesh->RegisterComponent();
+        RopeMeshPool.Add(NewMesh);
+    }
+
+    // Straight tangents per segment; particles are dense enough that the joints read as a smooth rope.
+    for (int32 Index = 0; Index < SegmentCount; ++Index)
+    {
+        if (USplineMeshComponent* const SplineMeshComp = RopeMeshPool[Index])
+        {
+            const FVector StartPos(Positions[Index]);
+            const FVector EndPos(Positions[Index + 1]);
+            const FVector Tangent = EndPos - StartPos;
+            SplineMeshComp->SetStartAndEnd(StartPos, Tangent, EndPos, Tangent);
+        }
+    }
+}
+#pragma endregion Simulation
+
+#pragma region Query
+FVector ABPA_LooseRope::GetAnchorLocation() const
+{
+    return Particles.IsInitialized() ? Particles.GetOrigin() : GetActorLocation();
+}
+
+FVector ABPA_LooseRope::GetAnchorNormal() const
+{
+    return AnchorNormal;
+}
+
+float ABPA_LooseRope::GetDistanceToRope(const FVector& Location) const
+{
+    if (!Particles.IsInitialized())
+    {
+        return static_cast<float>(FVector::Dist(Location, GetActorLocation()));
+    }
+
+    const TArray<FVector3f>& Positions = Particles.GetLocalPositions();
+    const FVector LocalLocation = Location - Particles.GetOrigin();
+    double MinDistanceSquared = TNumericLimits<double>::Max();
+
+    for (int32 Index = 1; Index < Positions.Num(); ++Index)
+    {
+        const FVector Closest = FMath::ClosestPointOnSegment(LocalLocation, FVector(Positions[Index - 1]), FVector(Positions[Index]));
+        MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(LocalLocation, Closest));
+    }
+
+    return static_cast<float>(FMath::Sqrt(MinDistanceSquared));
+}
+
+float ABPA_LooseRope::GetRopeLength() const
+{
+    return RopeLength;
+}
+#pragma endregion Query
+
+#pragma region Overlap
+void ABPA_LooseRope::HandleDisturbBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+    if (OtherActor == nullptr || OtherActor == this)
+    {
+        return;
+    }
+
+    WakeLooseRope();
+
+    if (UBPC_RopeTraversalComponent* const RopeComponent = OtherActor->FindComponentByClass<UBPC_RopeTraversalComponent>())
+    {
+        RopeComponent->SetNearbyLooseRope(this);
+    }
+}
+
+void ABPA_LooseRope::HandleDisturbEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+    if (OtherActor == nullptr)
+    {
+        return;
+    }
+
+    if (UBPC_RopeTraversalComponent* const RopeComponent = OtherActor->FindComponentByClass<UBPC_RopeTraversalComponent>())
+    {
+        RopeComponent->ClearNearbyLooseRope(this);
+    }
+}
+#pragma endregion Overlap
+#pragma endregion Methods
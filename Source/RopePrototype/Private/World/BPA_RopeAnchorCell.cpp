@@ -0,0 +1,75 @@
+// Summary: Implements registration of baked anchor cells with the anchor registry.
+#include "World/BPA_RopeAnchorCell.h"
+
+#include "Engine/World.h"
+#include "Subsystems/RopeAnchorRegistrySubsystem.h"
+#include "World/RopeAnchorCellData.h"
+
+#pragma region Methods
+#pragma region Lifecycle
+ABPA_RopeAnchorCell::ABPA_RopeAnchorCell()
+{
+    // Baked data is registered once per stream-in; nothing runs per frame.
+    PrimaryActorTick.bCanEverTick = false;
+
+    SetRootComponent(CreateDefaultSubobject<USceneComponent>(TEXT("CellRoot")));
+    GetRootComponent()->SetMobility(EComponentMobility::Static);
+}
+
+void ABPA_RopeAnchorCell::BeginPlay()
+{
+    Super::BeginPlay();
+
+    UWorld* const World = GetWorld();
+    URopeAnchorRegistrySubsystem* const Registry = World != nullptr ? World->GetSubsystem<URopeAnchorRegistrySubsystem>() : nullptr;
+
+    if (Registry == nullptr || CellData == nullptr)
+    {
+        return;
+    }
+
+    AnchorHandles.Reset(CellData->Anchors.Num());
+
+    for (const FRopeBakedAnchor& Anchor : CellData->Anchors)
+    {
+        FRopeAnchorDesc Desc;
+        Desc.Start = FVector(Anchor.Start);
+        Desc.End = FVector(Anchor.End);
+        Desc.Normal = FVector(Anchor.Normal);
+        Desc.Radius = CellData->AnchorRadius;
+        Desc.bHasLedge = Anchor.bHasLedge;
+        Desc.LedgeOffset = FVector(Anchor.LedgeOffset);
+        AnchorHandles.Add(Registry->RegisterAnchor(Desc));
+    }
+}
+
+void ABPA_RopeAnchorCell::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UWorld* const World = GetWorld();
+
+    if (URopeAnchorRegistrySubsystem* const Registry = World != nullptr ? World->GetSubsystem<URopeAnchorRegistrySubsystem>() : nullptr)
+    {
+        for (const int32 Handle : AnchorHandles)
+        {
+            Registry->UnregisterAnchor(Handle);
+        }
+    }
+
+    AnchorHandles.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+#pragma endregion Lifecycle
+
+#pragma region Bake
+void ABPA_RopeAnchorCell::SetCellData(URopeAnchorCellData* const InCellData)
+{
+    CellData = InCellData;
+}
+
+URopeAnchorCellData* ABPA_RopeAnchorCell::GetCellData() const
+{
+    return CellData;
+}
+#pragma endregion Bake
+#pragma endregion Methods
@@ -35,8 +35,8 @@ class ABPA_PlayerCharacter : public ACharacter
 public:
 #pragma region Methods
     
-    /// Sets default component hierarchy and movement defaults.
-    ABPA_PlayerCharacter();
+    /// Sets default component hierarchy, rope movement component, and movement defaults.
+    ABPA_PlayerCharacter(const FObjectInitializer& ObjectInitializer);
 
     
     /// Tick handles camera interpolation, fall tracking, and rope prompts.
@@ -126,6 +126,26 @@ protected:
     float RopeRadius;
 
     
+    /// Spline mesh pool drawing the predicted jump release arc.
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Rope|Release Preview", meta=(Tooltip="Spline mesh pool drawing the jump release arc while hanging", AllowPrivateAccess="true"))
+    TArray<USplineMeshComponent*> ReleasePreviewMeshPool;
+
+    
+    /// Static mesh used for release arc segments; no arc is drawn without one.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Rope|Release Preview", meta=(Tooltip="Static mesh used for release arc segments; leave empty to hide the arc", AllowPrivateAccess="true"))
+    UStaticMesh* ReleasePreviewMesh;
+
+    
+    /// Material override applied to release arc segments.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Rope|Release Preview", meta=(Tooltip="Material override applied to release arc segments", AllowPrivateAccess="true"))
+    UMaterialInterface* ReleasePreviewMaterial;
+
+    
+    /// Radius scale applied to release arc mesh thickness.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Rope|Release Preview", meta=(Tooltip="Radius scale applied to release arc mesh thickness", AllowPrivateAccess="true"))
+    float ReleasePreviewRadius;
+
+    
     /// Socket used to attach the rope cable to the character mesh.
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Rope", meta=(DisplayName="Rope Cable Socket", Tooltip="Socket on the character mesh used as rope cable start", AllowPrivateAccess="true"))
     FName RopeCableAttachSocket;
@@ -367,6 +387,10 @@ protected:
     bool bIgnoreFallFromRope;
 
     
+    /// Whether the spline already shows the sleeping rope and can skip rebuilds.
+    bool bRopeVisualAsleep;
+
+    
     /// Whether a death/reset sequence is active.
     bool bDeathSequenceActive;
 
@@ -498,27 +522,35 @@ private:
 
     
     /// Updates rope visual cable to follow the current anchor.
-    void UpdateRopeVisual(float DeltaSeconds);
+    void UpdateRopeVisual();
 
     
     /// Regenerates rope spline and mesh segments.
-    void UpdateRopeSplineVisual(const FVector& SocketLocation, const FVector& AnchorLocation, float DeltaSeconds);
+    void UpdateRopeSplineVisual(const FVector& SocketLocation, const FVector& AnchorLocation);
 
     
-    /// Ensures rope mesh pool matches the desired segment count.
-    void EnsureRopeMeshPool(const int32 SegmentCount);
+    /// Builds rope spline and mesh segments from simulated rope particles.
+    void UpdateRopeSplineFromParticles(const FVector& SocketLocation, const TArray<FVector>& Particles);
 
     
-    /// Hides all rope spline mesh instances.
-    void HideRopeMeshes();
+    /// Lays out pooled spline meshes along the current rope spline.
+    void LayoutRopeMeshes();
+
+    
+    /// Grows a spline mesh pool to the desired segment count.
+    void EnsureSplineMeshPool(TArray<USplineMeshComponent*>& MeshPool, const int32 SegmentCount);
 
     
-    /// Cached rope contact for smoothing visual kinks.
-    FVector RopeContactPoint;
+    /// Hides every spline mesh instance in a pool.
+    void HideSplineMeshes(const TArray<USplineMeshComponent*>& MeshPool);
+
+    
+    /// Hides all rope spline mesh instances.
+    void HideRopeMeshes();
 
     
-    /// Whether a rope contact point is cached.
-    bool bHasRopeContact;
+    /// Draws the predicted jump release arc while hanging.
+    void UpdateReleasePreviewVisual();
 
     
     /// Shows aim icon feedback based on preview validity.
@@ -0,0 +1,24 @@
+// Summary: Commandlet baking grapple anchors and ledge stand locations into per-cell data assets
+// (e.g. -run=RopeAnchorBake -map=/Game/Levels/LV_LevelingVero,/Game/Levels/LV_Final). Editor builds only.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "RopeAnchorBakeCommandlet.generated.h"
+
+UCLASS()
+class URopeAnchorBakeCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+#pragma region Methods
+    // Summary: Configures the commandlet to run inside the editor.
+    URopeAnchorBakeCommandlet();
+
+    // Summary: Bakes every listed map cell by cell, saving one data asset and one streamed cell actor per cell with anchors.
+    // Options: -map= (comma separated), -character= (class supplying the ledge rules), -spacing=, -cellsize=,
+    // -anchorradius=, -output=.
+    virtual int32 Main(const FString& Params) override;
+#pragma endregion Methods
+};
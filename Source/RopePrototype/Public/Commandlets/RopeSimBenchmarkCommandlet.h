@@ -0,0 +1,21 @@
+// Summary: Commandlet running rope simulation benchmarks headless (e.g. -run=RopeSimBenchmark -nullrhi -steps=50000).
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "RopeSimBenchmarkCommandlet.generated.h"
+
+UCLASS()
+class URopeSimBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+#pragma region Methods
+    // Summary: Configures the commandlet to run without editor or client world.
+    URopeSimBenchmarkCommandlet();
+
+    // Summary: Runs all rope benchmark scenarios and logs ns per step and steps per second.
+    virtual int32 Main(const FString& Params) override;
+#pragma endregion Methods
+};
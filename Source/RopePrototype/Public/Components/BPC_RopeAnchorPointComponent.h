@@ -0,0 +1,64 @@
+// Summary: Marks a point or beam the rope can grapple; registers with the anchor registry so aim assist can find it.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "BPC_RopeAnchorPointComponent.generated.h"
+
+class URopeAnchorRegistrySubsystem;
+
+UCLASS(ClassGroup=(Rope), meta=(BlueprintSpawnableComponent))
+class UBPC_RopeAnchorPointComponent : public USceneComponent
+{
+    GENERATED_BODY()
+
+public:
+#pragma region Methods
+#pragma region Lifecycle
+    // Summary: Sets defaults for a single grapple point.
+    UBPC_RopeAnchorPointComponent();
+
+    // Summary: Adds the anchor to the world registry.
+    virtual void BeginPlay() override;
+
+    // Summary: Removes the anchor from the world registry.
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+#pragma endregion Lifecycle
+
+#pragma region Query
+    // Summary: Returns the anchor span in world space; both ends match for a point anchor.
+    void GetAnchorSegment(FVector& OutStart, FVector& OutEnd) const;
+
+    // Summary: Returns the world normal the rope attaches with.
+    FVector GetAnchorNormal() const;
+
+    // Summary: Returns the magnet radius that widens the aim cone around the anchor.
+    float GetAnchorRadius() const;
+#pragma endregion Query
+#pragma endregion Methods
+
+protected:
+    // Summary: Moves the registry entry along with the component.
+    virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+
+private:
+#pragma region Variables And Properties
+#pragma region Serialized Fields
+    // Summary: Half length of the beam along local X; zero makes a single point.
+    UPROPERTY(EditAnywhere, Category="Rope|Anchor", meta=(ToolTip="Half length in centimeters of the grapple span along local X; 0 for a single point, the beam half length for beams and ledges", ClampMin="0.0", AllowPrivateAccess="true"))
+    float AnchorHalfLength;
+
+    // Summary: Extra radius around the span counted as on target.
+    UPROPERTY(EditAnywhere, Category="Rope|Anchor", meta=(ToolTip="Radius in centimeters around the span that aim assist treats as a hit; keep it near the visible thickness", ClampMin="0.0", AllowPrivateAccess="true"))
+    float AnchorRadius;
+#pragma endregion Serialized Fields
+
+#pragma region State
+    // Summary: Registry holding the entry while playing.
+    TWeakObjectPtr<URopeAnchorRegistrySubsystem> Registry;
+
+    // Summary: Entry handle in the registry, or INDEX_NONE while unregistered.
+    int32 RegistryHandle;
+#pragma endregion State
+#pragma endregion Variables And Properties
+};
@@ -0,0 +1,102 @@
+// Summary: Character movement component integrating rope swing and ground tether inside the movement update.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "BPC_RopeMovementComponent.generated.h"
+
+class UBPC_RopeTraversalComponent;
+
+// Summary: Custom movement modes used with MOVE_Custom.
+UENUM(BlueprintType)
+enum class ERopeMovementMode : uint8
+{
+    None,
+    RopeSwing
+};
+
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class UBPC_RopeMovementComponent : public UCharacterMovementComponent
+{
+    GENERATED_BODY()
+
+public:
+#pragma region Methods
+    // Summary: Builds defaults for rope floor probing.
+    UBPC_RopeMovementComponent();
+
+    // Summary: Caches the owning rope traversal component.
+    virtual void BeginPlay() override;
+
+    // Summary: Allocates prediction data that records rope climb input in saved moves.
+    virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+    // Summary: Sets the climb direction replayed through saved moves, 1 up, -1 down.
+    void SetRopeClimbInput(int32 ClimbSign);
+
+    // Summary: Returns the climb direction used by the current move.
+    int32 GetRopeClimbInput() const;
+
+    // Summary: Returns whether the character is in the rope swing custom mode.
+    bool IsRopeSwinging() const;
+
+    // Summary: Converts movement acceleration into rope swing input, X right and Y forward.
+    FVector2D GetRopeSwingInput() const;
+#pragma endregion Methods
+
+protected:
+#pragma region Methods
+    // Summary: Dispatches rope custom modes.
+    virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+
+    // Summary: Walks, then applies the rope tether within the same update.
+    virtual void PhysWalking(float DeltaTime, int32 Iterations) override;
+
+    // Summary: Falls, then applies the rope tether within the same update.
+    virtual void PhysFalling(float DeltaTime, int32 Iterations) override;
+
+    // Summary: Restores climb input from the compressed saved-move flags.
+    virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+#pragma endregion Methods
+
+#pragma region Variables And Properties
+#pragma region Serialized Fields
+    // Summary: Downward probe used to refresh the floor while swinging.
+    UPROPERTY(EditDefaultsOnly, Category="Rope", meta=(ToolTip="Floor probe distance in centimeters while swinging, run only after walkable hits or within this height of the bottom of the arc; keep above the rope component's ground climb proximity", ClampMin="0.0", AllowPrivateAccess="true"))
+    float RopeFloorProbeDistance;
+#pragma endregion Serialized Fields
+#pragma endregion Variables And Properties
+
+private:
+#pragma region Methods
+#pragma region Helpers
+    // Summary: Integrates the pendulum constraint with one swept move per fixed rope step.
+    void PhysRopeSwing(float DeltaTime, int32 Iterations);
+
+    // Summary: Pulls the character back inside rope length after ground or air movement.
+    void ApplyRopeTether(float DeltaTime);
+
+    // Summary: Advances the rope's fixed-step clock, or the replay clock during corrections; returns the steps to run.
+    int32 BeginRopeSteps(UBPC_RopeTraversalComponent& Rope, float DeltaTime);
+
+    // Summary: Moves the capsule toward a solved rope location, sliding along blocking hits; reports the contact hit.
+    void MoveToRopeLocation(const FVector& TargetLocation, float DeltaTime, FHitResult& OutHit);
+
+    // Summary: Takes floor contact from the move hit, probing only on walkable hits or near the bottom of the arc.
+    void UpdateRopeFloor(const UBPC_RopeTraversalComponent& Rope, const FHitResult& MoveHit);
+#pragma endregion Helpers
+#pragma endregion Methods
+
+#pragma region Variables And Properties
+#pragma region State
+    // Summary: Rope traversal component on the same character.
+    TWeakObjectPtr<UBPC_RopeTraversalComponent> RopeComponent;
+
+    // Summary: Climb direction applied by the current move.
+    int32 RopeClimbInput;
+
+    // Summary: Unsimulated rope time carried between replayed moves of one correction.
+    float RopeReplayAccumulator;
+#pragma endregion State
+#pragma endregion Variables And Properties
+};
@@ -3,10 +3,23 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "Simulation/RopeInputBuffer.h"
+#include "Simulation/RopeSimCore.h"
+#include "Subsystems/RopeAnchorRegistrySubsystem.h"
+#include "Tasks/Task.h"
 #include "BPC_RopeTraversalComponent.generated.h"
 
 class ACharacter;
 class UCharacterMovementComponent;
+class UPrimitiveComponent;
+class URopeSimulationSubsystem;
+class UBPC_RopeMovementComponent;
+class ABPA_LooseRope;
+class FRopeCollisionField;
+struct FRopeAsyncRopeInput;
+struct FRopeAsyncRopeOutput;
 
 UENUM(BlueprintType)
 enum class ERopeState : uint8
@@ -19,6 +32,93 @@ enum class ERopeState : uint8
     Recalling
 };
 
+// Summary: How the hanging rope responds to load.
+UENUM(BlueprintType)
+enum class ERopeStretchMode : uint8
+{
+    Rigid,
+    Elastic
+};
+
+// Summary: Time integrator for hanging swing when the rope moves the character itself.
+UENUM(BlueprintType)
+enum class ERopeSwingIntegrator : uint8
+{
+    Explicit,
+    Rattle,
+    RK4
+};
+
+// Summary: Point where the rope bends around geometry between the anchor and the character.
+struct FRopeWrapPivot
+{
+    // Summary: Pivot location pushed off the wrapped surface.
+    FVector Location = FVector::ZeroVector;
+
+    // Summary: Bend axis captured when the pivot was pushed; the pivot pops once the bend turns against it.
+    FVector BendAxis = FVector::ZeroVector;
+};
+
+// Summary: Collision state of one release preview segment between two arc samples.
+enum class ERopeReleaseSegment : uint8
+{
+    Unswept,
+    Pending,
+    Clear,
+    Blocked
+};
+
+// Summary: Significance bucket of a rope user, from full simulation down to kinematic layout.
+UENUM(BlueprintType)
+enum class ERopeSignificance : uint8
+{
+    Full,
+    Reduced,
+    Minimal,
+    Kinematic,
+    Count UMETA(Hidden)
+};
+
+// Summary: Simulation and visual budget applied to a rope while it sits in one significance bucket.
+USTRUCT(BlueprintType)
+struct FRopeSignificanceBudget
+{
+    GENERATED_BODY()
+
+    // Summary: Builds an unrestricted budget.
+    FRopeSignificanceBudget() = default;
+
+    // Summary: Builds a budget from explicit limits.
+    FRopeSignificanceBudget(const float InMaxViewDistance, const float InSimulationRateScale, const int32 InMaxVisualSegments, const bool bInContactSweeps, const bool bInKinematic)
+        : MaxViewDistance(InMaxViewDistance)
+        , SimulationRateScale(InSimulationRateScale)
+        , MaxVisualSegments(InMaxVisualSegments)
+        , bContactSweeps(bInContactSweeps)
+        , bKinematic(bInKinematic)
+    {
+    }
+
+    // Summary: View distance up to which a rope stays in this bucket.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Significance", meta=(ToolTip="Distance in centimeters from the nearest local view up to which a rope stays in this bucket; ignored for the last bucket", ClampMin="0.0"))
+    float MaxViewDistance = 0.0f;
+
+    // Summary: Fraction of the rope simulation rate kept in this bucket, for batched and movement-driven steps alike.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Significance", meta=(ToolTip="Multiplier on the fixed rope simulation rate, including steps run by the rope movement component; ropes of client-predicted characters keep full rate on the server", ClampMin="0.05", ClampMax="1.0"))
+    float SimulationRateScale = 1.0f;
+
+    // Summary: Upper bound of rendered rope mesh segments; zero keeps the full count.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Significance", meta=(ToolTip="Maximum spline mesh segments and particle spline points drawn for the rope; 0 means unlimited", ClampMin="0"))
+    int32 MaxVisualSegments = 0;
+
+    // Summary: Whether rope particles sweep for contacts.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Significance", meta=(ToolTip="Sweep interior rope particles against the world after each step"))
+    bool bContactSweeps = true;
+
+    // Summary: Whether the rope stops simulating and is laid out from the replicated character pose.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Significance", meta=(ToolTip="Skip simulation and wrap traces and draw the rope as a sagging spline; only applies to simulated proxies whose movement is replicated"))
+    bool bKinematic = false;
+};
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class UBPC_RopeTraversalComponent : public UActorComponent
 {
@@ -26,14 +126,65 @@ class UBPC_RopeTraversalComponent : public UActorComponent
 
 public:
 #pragma region Methods
-    // Summary: Builds defaults and sets tick off by default.
+    // Summary: Builds defaults; the component never ticks itself.
     UBPC_RopeTraversalComponent();
 
-    // Summary: Initializes owner references.
+    // Summary: Initializes owner references and registers with the rope simulation subsystem.
     virtual void BeginPlay() override;
 
-    // Summary: Tick used only for aiming, hanging, or recall feedback.
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    // Summary: Unregisters from the rope simulation subsystem.
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    // Summary: Runs aim, flight, and recall for this frame and returns the fixed rope steps owed.
+    int32 BeginRopeFrame(float DeltaTime);
+
+    // Summary: Gathers core inputs for one fixed step; returns false when the rope left simulation.
+    bool PrepareRopeStep(FRopeSimParams& OutParams, FRopeSimInput& OutInput, ERopeSimStepKind& OutKind);
+
+    // Summary: Applies a finished core step to the character and the world.
+    void ApplyRopeStep(ERopeSimStepKind Kind);
+
+    // Summary: Clears per-frame input and refreshes interpolated render particles.
+    void EndRopeFrame();
+
+    // Summary: Updates the packed slot after the subsystem compacts its arrays.
+    void SetSimulationSlot(int32 Slot);
+
+    // Summary: Adds movement time to the fixed-step clock and opens its input window; returns how many whole steps to run.
+    int32 BeginRopeMovementFrame(float DeltaTime);
+
+    // Summary: Blends render particles across the time still held in the fixed-step clock.
+    void EndRopeMovementFrame();
+
+    // Summary: Adds time to an accumulator and removes the whole fixed steps it holds, capped at the substep limit.
+    int32 ConsumeSimulationSteps(float DeltaTime, float& InOutAccumulator) const;
+
+    // Summary: Returns duration of one fixed rope simulation step at the current significance rate.
+    float GetSimulationStepSeconds() const;
+
+    // Summary: Advances one fixed movement step through the core; returns null when the rope left that mode.
+    const FRopeSimState* AdvanceRopeMovement(ERopeSimStepKind Kind, float DeltaTime, const FVector2D& SwingInput, int32 ClimbSign, int32 ClimbTapSign);
+
+    // Summary: Runs ground and tension transitions after the movement component moved the character.
+    void FinishRopeMovementStep(ERopeSimStepKind Kind);
+
+    // Summary: Puts back the rope length and wrap pivot count a replayed saved move started with.
+    void RestoreRopeForReplay(float RopeLength, int32 WrapPivotCount);
+
+    // Summary: Returns whether the rope tethers a character that holds it without hanging.
+    bool IsTetherActive() const;
+
+    // Summary: Returns whether the rope movement component integrates the rope inside its own update.
+    bool IsMovementDriven() const;
+
+    // Summary: Returns whether hanging or tether currently runs in the Chaos async physics callback.
+    bool IsSimulatedOnPhysicsThread() const;
+
+    // Summary: Fills the physics-thread input for this rope; returns false when the rope left simulation.
+    bool PrepareAsyncRopeInput(FRopeAsyncRopeInput& OutInput);
+
+    // Summary: Applies a physics-thread result to the character and the world.
+    void ApplyAsyncRopeOutput(const FRopeAsyncRopeOutput& Output);
 
     // Summary: Starts aim logic and enables preview updates.
     void StartAim();
@@ -53,9 +204,27 @@ public:
     // Summary: Cancels rope recall timing.
     void CancelRecall();
 
+    // Summary: Offers a dropped rope the character may pick up with the hold input.
+    void SetNearbyLooseRope(ABPA_LooseRope* LooseRope);
+
+    // Summary: Withdraws a dropped rope offer if it is the current one.
+    void ClearNearbyLooseRope(const ABPA_LooseRope* LooseRope);
+
     // Summary: Drives swing acceleration from directional input while hanging.
     void ApplySwingInput(const FVector2D InputAxis);
 
+    // Summary: Records a swing input change with its timestamp for sub-frame consumption, then applies it.
+    void RecordSwingInput(const FVector2D& InputAxis);
+
+    // Summary: Records a climb input change with its timestamp for sub-frame consumption.
+    void RecordClimbInput(int32 ClimbSign);
+
+    // Summary: Maps the simulated seconds of this frame's upcoming substeps onto the input recorded since the last frame.
+    void BeginRopeInputFrame(float SimulatedSeconds);
+
+    // Summary: Pops the recorded input inside the next substep window; returns false when sub-frame input does not apply.
+    bool ConsumeRopeInput(float StepSeconds, FRopeInputWindow& OutWindow);
+
     // Summary: Begins climb up movement.
     void BeginClimbUp();
 
@@ -92,6 +261,22 @@ public:
     // Summary: Returns whether preview is within rope reach.
     bool IsPreviewWithinRange() const;
 
+    // Summary: Returns aim preview traces issued since aiming started.
+    UFUNCTION(BlueprintPure, Category="Rope|Aim")
+    int32 GetAimTracesIssued() const;
+
+    // Summary: Returns aim preview frames since aiming started that reused the last trace because the view held still.
+    UFUNCTION(BlueprintPure, Category="Rope|Aim")
+    int32 GetAimTracesSkipped() const;
+
+    // Summary: Returns whether the throw arc toward the aim preview hits something before the target.
+    UFUNCTION(BlueprintPure, Category="Rope|Aim")
+    bool IsPreviewArcBlocked() const;
+
+    // Summary: Returns whether every segment of the throw arc toward the aim preview has been swept clear.
+    UFUNCTION(BlueprintPure, Category="Rope|Aim")
+    bool IsPreviewArcClear() const;
+
     // Summary: Returns whether rope is currently recalling.
     bool IsRecalling() const;
 
@@ -103,6 +288,72 @@ public:
 
     // Summary: Attempts ledge climb transition triggered by jump.
     bool RequestLedgeClimbFromJump();
+
+    // Summary: Returns the ledge probe radius, normal threshold, and stand-off the climb uses, so baked ledges match it.
+    void GetLedgeRules(float& OutProbeRadius, float& OutNormalDotThreshold, float& OutStandOffDistance) const;
+
+    // Summary: Returns whether the rope particle chain currently drives the rope.
+    bool IsRopeSimulated() const;
+
+    // Summary: Returns whether an idle rope is dormant and skips simulation, wrap traces, and visual rebuilds.
+    bool IsRopeAsleep() const;
+
+    // Summary: Wakes a dormant rope; call after applying an external impulse to the character.
+    void WakeRope();
+
+    // Summary: Returns the rope pull on the character in newtons after the last step; zero while slack or detached.
+    UFUNCTION(BlueprintPure, Category="Rope|Tension")
+    float GetRopeTension() const;
+
+    // Summary: Returns rope tension relative to the character's weight; one while hanging still, higher at the bottom of a swing.
+    UFUNCTION(BlueprintPure, Category="Rope|Tension")
+    float GetRopeTensionRatio() const;
+
+    // Summary: Returns the impulse in newton-seconds the rope constraint applied to the character in the last step.
+    UFUNCTION(BlueprintPure, Category="Rope|Tension")
+    FVector GetRopeConstraintImpulse() const;
+
+    // Summary: Returns the number of simulated rope segments; zero until the rope has particles.
+    UFUNCTION(BlueprintPure, Category="Rope|Tension")
+    int32 GetRopeSegmentCount() const;
+
+    // Summary: Returns the tension of one segment in newtons; segment 0 hangs from the swing pivot.
+    UFUNCTION(BlueprintPure, Category="Rope|Tension")
+    float GetRopeSegmentTension(int32 Segment) const;
+
+    // Summary: Writes the tension of every segment in newtons ordered from the swing pivot to the character.
+    UFUNCTION(BlueprintCallable, Category="Rope|Tension")
+    void GetRopeSegmentTensions(TArray<float>& OutTensions) const;
+
+    // Summary: Writes simulated rope particles in world space ordered from anchor to character.
+    void GetRopeParticlePositions(TArray<FVector>& OutPositions) const;
+
+    // Summary: Returns rope particles interpolated between the last two fixed simulation steps for rendering.
+    const TArray<FVector>& GetRopeRenderPositions() const;
+
+    // Summary: Returns wrap pivots ordered from the anchor toward the character.
+    const TArray<FRopeWrapPivot>& GetRopeWrapPivots() const;
+
+    // Summary: Returns the point the free rope swings from: the last wrap pivot, or the anchor when unwrapped.
+    FVector GetSwingPivot() const;
+
+    // Summary: Returns the predicted character path after a jump release, ending at the first blocking hit; empty when hidden.
+    const TArray<FVector>& GetReleasePreviewPoints() const;
+
+    // Summary: Returns whether the release path hits geometry within the preview horizon, with the impact point and normal.
+    bool GetReleasePreviewLanding(FVector& OutLocation, FVector& OutNormal) const;
+
+    // Summary: Picks the significance bucket from the distance to the nearest local view and whether the owner was recently rendered.
+    void UpdateRopeSignificance(float ViewDistance, bool bRecentlyRendered);
+
+    // Summary: Returns the current significance bucket.
+    ERopeSignificance GetRopeSignificance() const;
+
+    // Summary: Returns the budget of the current significance bucket.
+    const FRopeSignificanceBudget& GetSignificanceBudget() const;
+
+    // Summary: Returns whether the rope is laid out kinematically instead of simulated.
+    bool IsRopeKinematic() const;
 #pragma endregion Methods
 
 protected:
@@ -128,6 +379,14 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category="Rope", meta=(ToolTip="Projectile speed for rope throw in centimeters per second", AllowPrivateAccess="true"))
     float ThrowSpeed;
 
+    // Summary: Swept segments the throw arc is split into; bounds the collision queries of one throw.
+    UPROPERTY(EditDefaultsOnly, Category="Rope", meta=(ToolTip="Number of equal arc segments swept for collision over a whole throw, whatever the frame rate; each is swept once, just ahead of the rope tip", ClampMin="1", ClampMax="128", AllowPrivateAccess="true"))
+    int32 RopeFlightSweepSegments;
+
+    // Summary: Radius of the rope tip swept along the throw arc.
+    UPROPERTY(EditDefaultsOnly, Category="Rope", meta=(ToolTip="Sphere radius in centimeters swept along the throw arc; the rope attaches to the first surface it touches", ClampMin="0.0", AllowPrivateAccess="true"))
+    float RopeFlightSweepRadius;
+
     // Summary: Time the recall input must be held.
     UPROPERTY(EditDefaultsOnly, Category="Rope", meta=(ToolTip="Hold duration in seconds before the rope returns to the player", AllowPrivateAccess="true"))
     float RecallHoldSeconds;
@@ -153,7 +412,7 @@ protected:
     float LedgeNormalDotThreshold;
 
     // Summary: Distance required to snap onto held rope.
-    UPROPERTY(EditDefaultsOnly, Category="Rope", meta=(ToolTip="Maximum distance allowed to grab the rope loose end", AllowPrivateAccess="true"))
+    UPROPERTY(EditDefaultsOnly, Category="Rope", meta=(ToolTip="Maximum distance allowed to grab the rope loose end or a dropped rope", AllowPrivateAccess="true"))
     float GrabDistance;
 
     // Summary: Radius used to sample ledge when near anchor.
@@ -180,6 +439,162 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category="Rope", meta=(ToolTip="Distance from the ground where hanging switches to custom movement to suppress falling animation", AllowPrivateAccess="true"))
     float GroundClimbProximity;
 
+    // Summary: Number of particles in the simulated rope chain including anchor and character.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="Particles in the XPBD rope chain including the anchor and the character end", ClampMin="2", ClampMax="256", AllowPrivateAccess="true"))
+    int32 RopeParticleCount;
+
+    // Summary: Constraint projection passes per rope simulation step.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="XPBD constraint iterations per rope simulation step", ClampMin="1", ClampMax="64", AllowPrivateAccess="true"))
+    int32 RopeSolverIterations;
+
+    // Summary: Inverse mass of the character end relative to a single rope particle.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="Character inverse mass relative to one rope particle; lower values let the character drag the rope instead of the reverse", ClampMin="0.0", AllowPrivateAccess="true"))
+    float RopeCharacterInverseMass;
+
+    // Summary: Collision radius of interior rope particles.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="Sphere radius in centimeters swept for each interior rope particle; 0 disables rope contacts", ClampMin="0.0", AllowPrivateAccess="true"))
+    float RopeCollisionRadius;
+
+    // Summary: Resolves rope contacts with static geometry from a cached distance field instead of per-particle sweeps.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="Build a sparse distance field of static collision around the anchor when the rope attaches; particles sample it and only sweep near movable bodies or complex-only collision", AllowPrivateAccess="true"))
+    bool bUseRopeCollisionField;
+
+    // Summary: Cell size of the rope collision field.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="Distance field cell size in centimeters; smaller cells follow edges closer but take longer to build", ClampMin="2.0", AllowPrivateAccess="true", EditCondition="bUseRopeCollisionField"))
+    float RopeCollisionVoxelSize;
+
+    // Summary: Fixed rate of the rope simulation in steps per second.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="Fixed rope simulation rate in steps per second; swing behaves identically at any frame rate", ClampMin="10.0", ClampMax="1000.0", AllowPrivateAccess="true"))
+    float SimulationStepRate;
+
+    // Summary: Upper bound of fixed steps run in a single frame.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="Maximum fixed rope steps per frame; leftover time after a hitch is dropped instead of simulated", ClampMin="1", ClampMax="16", AllowPrivateAccess="true"))
+    int32 MaxSimulationSubsteps;
+
+    // Summary: Integrator for rigid hanging swing.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="Explicit is cheapest but drifts energy with step size; Rattle and RK4 conserve swing energy at low rates. Applies with the rope movement component or physics-thread simulation", AllowPrivateAccess="true"))
+    ERopeSwingIntegrator SwingIntegrator;
+
+    // Summary: Runs the hanging and tether constraint in the Chaos async physics callback.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Simulation", meta=(ToolTip="Solve hanging and tether on the physics thread; the game thread only pushes input and applies results. Enable Tick Physics Async in project settings for a fixed physics rate", AllowPrivateAccess="true"))
+    bool bSimulateOnPhysicsThread;
+
+    // Summary: Feeds every substep the input recorded inside its time window instead of one value per frame.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Input", meta=(ToolTip="Substeps consume timestamped swing and climb input in their own time window, so taps shorter than a frame still swing and climb. Only a locally controlled player with authority (standalone or listen-server host) uses it; networked clients and the server step with the replicated per-move input so prediction matches", AllowPrivateAccess="true"))
+    bool bUseSubframeInput;
+
+    // Summary: Chooses an inextensible or a bungee rope while hanging.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Elastic", meta=(ToolTip="Rigid holds the rope at its length; Elastic lets it stretch and pull back with an implicitly integrated spring. The ground tether stays rigid in both modes", AllowPrivateAccess="true"))
+    ERopeStretchMode RopeStretchMode;
+
+    // Summary: Elastic spring stiffness per unit character mass.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Elastic", meta=(ToolTip="Pull in centimeters per second squared per centimeter of stretch; stable at any value because the spring is integrated implicitly", ClampMin="0.0", EditCondition="RopeStretchMode==ERopeStretchMode::Elastic", AllowPrivateAccess="true"))
+    float ElasticStiffness;
+
+    // Summary: Elastic damping of stretch speed per unit character mass.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Elastic", meta=(ToolTip="Damping of the stretch speed per second; higher values settle bounces faster", ClampMin="0.0", EditCondition="RopeStretchMode==ERopeStretchMode::Elastic", AllowPrivateAccess="true"))
+    float ElasticDamping;
+
+    // Summary: Bends the gameplay rope around geometry with a pivot stack.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Wrapping", meta=(ToolTip="Wrap the rope around corners so the swing radius is measured from the last contact instead of the anchor", AllowPrivateAccess="true"))
+    bool bEnableRopeWrapping;
+
+    // Summary: Distance wrap pivots are pushed off the surface they were found on.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Wrapping", meta=(ToolTip="Offset in centimeters from the wrapped surface to the pivot so the next trace starts outside geometry", ClampMin="0.1", AllowPrivateAccess="true"))
+    float RopeWrapOffset;
+
+    // Summary: Upper bound of simultaneous wrap pivots.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Wrapping", meta=(ToolTip="Maximum corners the rope can wrap around at once", ClampMin="0", ClampMax="32", AllowPrivateAccess="true"))
+    int32 MaxRopeWrapPivots;
+
+    // Summary: Lets idle attached ropes go dormant.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Sleep", meta=(ToolTip="Put the rope to sleep when the character holds or hangs still; it wakes on input, movement mode change, or external motion", AllowPrivateAccess="true"))
+    bool bAllowRopeSleep;
+
+    // Summary: Speed below which the rope counts as still.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Sleep", meta=(ToolTip="Character speed in centimeters per second below which the rope counts as still; radial speed is ignored while hanging", ClampMin="0.0", AllowPrivateAccess="true"))
+    float SleepSpeedThreshold;
+
+    // Summary: Per-frame rope length change below which the rope counts as still.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Sleep", meta=(ToolTip="Rope length change in centimeters per frame below which the rope counts as still", ClampMin="0.0", AllowPrivateAccess="true"))
+    float SleepLengthThreshold;
+
+    // Summary: Consecutive still frames before the rope sleeps.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Sleep", meta=(ToolTip="Consecutive still frames required before the rope goes dormant", ClampMin="1", AllowPrivateAccess="true"))
+    int32 SleepFramesRequired;
+
+    // Summary: Character displacement that wakes a sleeping rope.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Sleep", meta=(ToolTip="Distance in centimeters the character may be pushed from its sleep location before the rope wakes", ClampMin="0.0", AllowPrivateAccess="true"))
+    float SleepWakeDistance;
+
+    // Summary: Simulation and visual budget per significance bucket.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Significance", meta=(ToolTip="Budgets for ropes not owned by the local player, chosen by distance to the nearest local view", ArraySizeEnum="ERopeSignificance", AllowPrivateAccess="true"))
+    FRopeSignificanceBudget SignificanceBudgets[static_cast<int32>(ERopeSignificance::Count)];
+
+    // Summary: Most significant bucket an off-screen rope may use.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Significance", meta=(ToolTip="Ropes whose owner was not recently rendered never rank above this bucket", AllowPrivateAccess="true"))
+    ERopeSignificance OffscreenSignificance;
+
+    // Summary: Shows where a jump release would carry the character while hanging.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Release Preview", meta=(ToolTip="Predict and expose the jump release arc while the local player hangs", AllowPrivateAccess="true"))
+    bool bShowReleasePreview;
+
+    // Summary: Flight time covered by the release preview.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Release Preview", meta=(ToolTip="Seconds of flight predicted after release", ClampMin="0.1", ClampMax="10.0", AllowPrivateAccess="true"))
+    float ReleasePreviewSeconds;
+
+    // Summary: Flight time between two preview samples; each pair of samples is one collision sweep.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Release Preview", meta=(ToolTip="Seconds between arc samples; larger values mean fewer sweeps and a coarser arc", ClampMin="0.01", ClampMax="1.0", AllowPrivateAccess="true"))
+    float ReleasePreviewSampleSeconds;
+
+    // Summary: Distance a cached sample may drift before it and everything after it is re-simulated.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Release Preview", meta=(ToolTip="Sweeps are inflated by this margin in centimeters, so a cached clear segment stays valid while its samples move less than it", ClampMin="0.0", AllowPrivateAccess="true"))
+    float ReleasePreviewTolerance;
+
+    // Summary: Async sweeps the preview may issue per frame.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Release Preview", meta=(ToolTip="Maximum async collision sweeps issued per frame; results arrive next frame", ClampMin="1", ClampMax="64", AllowPrivateAccess="true"))
+    int32 ReleasePreviewMaxSweepsPerFrame;
+
+    // Summary: Game-thread time the preview may spend per frame.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Release Preview", meta=(ToolTip="Per-frame budget in milliseconds; at least one sweep is issued every frame so the preview always converges", ClampMin="0.0", AllowPrivateAccess="true"))
+    float ReleasePreviewBudgetMs;
+
+    // Summary: View movement below which the aim preview keeps its last trace.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Aim", meta=(ToolTip="Camera travel in centimeters since the last aim trace below which no new trace is issued", ClampMin="0.0", AllowPrivateAccess="true"))
+    float AimTraceLocationEpsilon;
+
+    // Summary: View rotation below which the aim preview keeps its last trace.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Aim", meta=(ToolTip="Camera rotation in degrees per axis since the last aim trace below which no new trace is issued", ClampMin="0.0", AllowPrivateAccess="true"))
+    float AimTraceRotationEpsilon;
+
+    // Summary: Whether aiming snaps to registered anchors near the crosshair.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Aim", meta=(ToolTip="Rank registered anchors inside a view cone and confirm the best one with a single line-of-sight trace", AllowPrivateAccess="true"))
+    bool bUseAimAssist;
+
+    // Summary: Half angle of the aim assist cone.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Aim", meta=(ToolTip="Half angle in degrees of the view cone searched for anchors; each anchor's radius widens it further up close", ClampMin="0.0", ClampMax="30.0", AllowPrivateAccess="true"))
+    float AimAssistHalfAngle;
+
+    // Summary: Weight of distance against angular offset when ranking anchors.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Aim", meta=(ToolTip="0 picks the anchor nearest the crosshair; higher values prefer closer anchors", ClampMin="0.0", AllowPrivateAccess="true"))
+    float AimAssistDistanceWeight;
+
+    // Summary: Async throw arc sweeps issued per aim frame.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Aim", meta=(ToolTip="Maximum async sweeps validating the predicted throw arc per frame; results arrive next frame", ClampMin="1", ClampMax="32", AllowPrivateAccess="true"))
+    int32 AimArcMaxSweepsPerFrame;
+
+    // Summary: Grid the aim target and throw origin are snapped to before the arc is re-validated.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Aim", meta=(ToolTip="Cell size in centimeters; the throw arc is only swept again once the target or the character leaves its cell", ClampMin="1.0", AllowPrivateAccess="true"))
+    float AimArcCellSize;
+
+    // Summary: Scale on the rope's pull applied back to a physics-simulated anchor body.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Anchor", meta=(ToolTip="Multiplier on the reaction impulse pushed into a simulating anchor body; 0 lets the rope hang from props without moving them", ClampMin="0.0", AllowPrivateAccess="true"))
+    float AnchorReactionScale;
+
+    // Summary: Actor spawned to hold a dropped rope until it is picked up again.
+    UPROPERTY(EditDefaultsOnly, Category="Rope|Loose", meta=(ToolTip="Loose rope actor spawned when the held rope is dropped; empty recalls the rope instead", AllowPrivateAccess="true"))
+    TSubclassOf<ABPA_LooseRope> LooseRopeClass;
+
     // Summary: Enables debug draw for rope distances, probes, and assist areas.
     UPROPERTY(EditDefaultsOnly, Category="Debug", meta=(ToolTip="Draw debug spheres/lines for rope assist distances and ledge probes", AllowPrivateAccess="true"))
     bool bDebugRopeAssist;
@@ -195,8 +610,20 @@ protected:
     // Summary: Rope anchor normal for ledge detection.
     FVector AnchorNormal;
 
-    // Summary: Current rope length clamped during climbing.
-    float CurrentRopeLength;
+    // Summary: Movable component the anchor rides on; unset for static geometry, whose anchor never moves.
+    TWeakObjectPtr<UPrimitiveComponent> AnchorComponent;
+
+    // Summary: Bone of the anchor component the anchor rides on, or none for the component itself.
+    FName AnchorBoneName;
+
+    // Summary: Anchor location in the anchor component's frame.
+    FVector AnchorRelativeLocation;
+
+    // Summary: Anchor normal in the anchor component's frame.
+    FVector AnchorRelativeNormal;
+
+    // Summary: Rope pull accumulated by steps since it was last pushed into a simulating anchor, in kg cm/s.
+    float PendingAnchorImpulse;
 
     // Summary: Whether rope end is attached to world.
     bool bRopeAttached;
@@ -216,9 +643,6 @@ protected:
     // Summary: Stopwatch for recall progress.
     float RecallAccumulated;
 
-    // Summary: Climb direction input, 1 for up, -1 for down.
-    int32 ClimbInputSign;
-
     // Summary: Cached gravity scale before entering hanging.
     float SavedGravityScale;
 
@@ -234,6 +658,84 @@ protected:
     // Summary: Cached preview impact normal.
     FVector PreviewImpactNormal;
 
+    // Summary: Component hit by the preview trace.
+    TWeakObjectPtr<UPrimitiveComponent> PreviewImpactComponent;
+
+    // Summary: Bone hit by the preview trace.
+    FName PreviewImpactBoneName;
+
+    // Summary: Aim trace issued last frame; its result is read this frame.
+    FTraceHandle AimTraceHandle;
+
+    // Summary: View location of the last aim trace.
+    FVector LastAimTraceLocation;
+
+    // Summary: View rotation of the last aim trace.
+    FRotator LastAimTraceRotation;
+
+    // Summary: Whether an aim trace was issued since aiming started, so the change gate has a view to compare against.
+    bool bHasAimTraceView;
+
+    // Summary: Aim traces issued since aiming started.
+    int32 AimTracesIssued;
+
+    // Summary: Aim frames since aiming started that skipped the trace.
+    int32 AimTracesSkipped;
+
+    // Summary: Whether the pending aim trace confirms an assist candidate rather than following the crosshair.
+    bool bAimTraceIsAssist;
+
+    // Summary: Whether the last assist candidate was blocked, so the next trace follows the crosshair.
+    bool bAimAssistRejected;
+
+    // Summary: Anchor the pending assist trace is confirming.
+    FRopeAnchorCandidate AimAssistCandidate;
+
+    // Summary: Throw arc samples toward the aim preview, captured when its cells last changed.
+    TArray<FVector> AimArcSamples;
+
+    // Summary: Sweep state of each throw arc segment.
+    TArray<ERopeReleaseSegment> AimArcSegments;
+
+    // Summary: Async sweep in flight for each pending throw arc segment.
+    TArray<FTraceHandle> AimArcTraces;
+
+    // Summary: Earliest blocked throw arc segment, or INDEX_NONE while the swept prefix is clear.
+    int32 AimArcBlockedSegment;
+
+    // Summary: Cell of the throw origin the arc was sampled from.
+    FIntVector AimArcStartCell;
+
+    // Summary: Cell of the aim target the arc was sampled toward.
+    FIntVector AimArcTargetCell;
+
+    // Summary: Dropped rope close enough to offer pickup.
+    TWeakObjectPtr<ABPA_LooseRope> NearbyLooseRope;
+
+    // Summary: Static collision field the particles sample, shared with the build task that produced it.
+    TSharedPtr<FRopeCollisionField, ESPMode::ThreadSafe> RopeCollisionField;
+
+    // Summary: Field being built on a worker; swapped in once the task completes.
+    TSharedPtr<FRopeCollisionField, ESPMode::ThreadSafe> PendingRopeCollisionField;
+
+    // Summary: Worker task building the pending field.
+    UE::Tasks::FTask RopeCollisionFieldTask;
+
+    // Summary: Whether a field region was too large to build; latches the configuration below and logs once.
+    bool bRopeCollisionFieldFailed;
+
+    // Summary: Anchor of the field region that failed to build.
+    FVector FailedFieldAnchor;
+
+    // Summary: Swing reach of the failed region; the same or a longer reach at that anchor fails too.
+    float FailedFieldReach;
+
+    // Summary: Cell size the failed region was sized for.
+    float FailedFieldVoxelSize;
+
+    // Summary: Bounds of movable blocking bodies near the rope this frame; particles inside them keep sweeping the scene.
+    TArray<FBox> RopeDynamicBoxes;
+
     // Summary: Rope flight progress elapsed seconds.
     float RopeFlightElapsed;
 
@@ -246,11 +748,110 @@ protected:
     // Summary: Rope flight target location.
     FVector RopeFlightTarget;
 
+    // Summary: Arc segments already swept this throw.
+    int32 RopeFlightSweptSegments;
+
+    // Summary: Whether a sweep found geometry ahead of the rope tip.
+    bool bRopeFlightBlocked;
+
+    // Summary: Flight progress at which the rope tip reaches the blocking hit.
+    float RopeFlightBlockAlpha;
+
+    // Summary: Blocking hit the rope attaches to when the tip reaches it.
+    FHitResult RopeFlightBlockHit;
+
     // Summary: Tracks aim preview when rope already attached.
     bool bAimPreviewWhileAttached;
 
     // Summary: Timestamp of last successful ledge climb assist to enforce cooldown.
     float LastLedgeClimbTime;
+
+    // Summary: Simulation state used before registration and after end play; live state sits in the subsystem.
+    FRopeSimState UnregisteredSimState;
+
+    // Summary: Subsystem that owns the packed simulation state.
+    TWeakObjectPtr<URopeSimulationSubsystem> SimulationSubsystem;
+
+    // Summary: Index of this rope in the subsystem's packed arrays.
+    int32 SimulationSlot;
+
+    // Summary: Whether fixed steps were scheduled this frame.
+    bool bSimulatedThisFrame;
+
+    // Summary: Character location captured when the current fixed step was prepared.
+    FVector StepActorLocation;
+
+    // Summary: Reset counter telling the physics thread to rebuild its copy of the rope.
+    int32 AsyncGeneration;
+
+    // Summary: Unsimulated time carried over to the next frame.
+    float SimulationAccumulator;
+
+    // Summary: World-space particle positions before the latest fixed step.
+    TArray<FVector> PreviousStepPositions;
+
+    // Summary: Particle positions blended between the last two fixed steps.
+    TArray<FVector> RopeRenderPositions;
+
+    // Summary: Wrap pivots ordered from the anchor toward the character.
+    TArray<FRopeWrapPivot> RopeWrapPivots;
+
+    // Summary: Rope length laid along the wrap pivots.
+    float RopeWrappedLength;
+
+    // Summary: Character location at the last wrap update, the clear end used to locate corners.
+    FVector LastWrapEndLocation;
+
+    // Summary: Whether the free segment was clear at the last wrap update; blocked segments skip corner bisection.
+    bool bLastWrapSegmentClear;
+
+    // Summary: Whether the rope is dormant.
+    bool bRopeAsleep;
+
+    // Summary: Consecutive still frames counted toward sleep.
+    int32 RopeQuietFrames;
+
+    // Summary: Rope length at the last sleep check.
+    float SleepCheckRopeLength;
+
+    // Summary: Character location when the rope fell asleep.
+    FVector SleepLocation;
+
+    // Summary: Significance bucket picked by the last significance pass.
+    ERopeSignificance RopeSignificance;
+
+    // Summary: Movement mode when the rope fell asleep; any change wakes it.
+    TEnumAsByte<EMovementMode> SleepMovementMode;
+
+    // Summary: Custom movement mode when the rope fell asleep.
+    uint8 SleepCustomMovementMode;
+
+    // Summary: Timestamped input samples waiting for the substeps that cover them.
+    FRopeInputBuffer RopeInputBuffer;
+
+    // Summary: Most recent input state recorded by the input callbacks.
+    FRopeInputSample LatestRopeInput;
+
+    // Summary: Whether a sample was dropped on a full ring; the next drain resynchronizes to the latest input.
+    bool bRopeInputDropped;
+
+    // Summary: Cached release arc samples at fixed flight-time spacing.
+    TArray<FVector> ReleasePreviewSamples;
+
+    // Summary: Collision state of the segment starting at each sample.
+    TArray<ERopeReleaseSegment> ReleasePreviewSegments;
+
+    // Summary: Async sweep in flight for each pending segment.
+    TArray<FTraceHandle> ReleasePreviewTraces;
+
+    // Summary: Earliest blocked segment, or INDEX_NONE while the swept prefix is clear.
+    int32 ReleasePreviewBlockedSegment;
+
+    // Summary: Blocking hit of the earliest blocked segment.
+    FHitResult ReleasePreviewHit;
+
+    // Summary: Path exposed for rendering, trimmed at the blocking hit.
+    TArray<FVector> ReleasePreviewPoints;
 #pragma endregion State
 #pragma endregion Variables And Properties
 
@@ -266,17 +867,56 @@ private:
     // Summary: Finalizes rope flight and attaches.
     void CompleteRopeFlight();
 
+    // Summary: Sweeps the arc segments up to the one holding the rope tip, each once per throw, and records the first hit.
+    void SweepRopeFlight(float Alpha);
+
+    // Summary: Retargets the rope at the blocking hit and attaches there, or drops the rope when the hit cannot hold it.
+    void CompleteBlockedRopeFlight();
+
     // Summary: Begins hanging state if allowed.
     void EnterHanging();
 
     // Summary: Exits hanging and restores walking movement.
     void ExitHanging();
 
-    // Summary: Advances swing simulation and length adjustments.
-    void TickHanging(float DeltaTime);
+    // Summary: Returns rope length, climb input, and particle chain advanced by the simulation core.
+    FRopeSimState& GetSimState();
+
+    // Summary: Read-only access to the rope simulation state.
+    const FRopeSimState& GetSimState() const;
+
+    // Summary: Returns newtons per unit of core acceleration in cm/s^2 for the character mass; zero while the rope carries no load.
+    float GetRopeForceScale() const;
+
+    // Summary: Flags the rope active or idle in the simulation subsystem.
+    void SetSimulationActive(bool bActive);
+
+    // Summary: Sets climb input on the simulation state and the rope movement component.
+    void SetClimbInputSign(int32 ClimbSign);
+
+    // Summary: Returns the owner's rope movement component, or null when movement is corrected after the fact.
+    UBPC_RopeMovementComponent* GetRopeMovement() const;
+
+    // Summary: Clears accumulated time and interpolation history.
+    void ResetSimulationClock();
+
+    // Summary: Blends render particles between the previous and current fixed step.
+    void UpdateRopeRenderPositions(float Alpha);
+
+    // Summary: Leaves hanging when grounded or close to the floor; returns whether hanging continues.
+    bool CanContinueHanging(UCharacterMovementComponent& MoveComp);
+
+    // Summary: Moves the character to the solved swing location after a hanging step.
+    void ApplyHangingStep(UCharacterMovementComponent& MoveComp);
+
+    // Summary: Leaves hanging once the character touches walkable ground.
+    void FinishHangingStep(UCharacterMovementComponent& MoveComp);
 
     // Summary: Applies ground tether constraint while holding the rope.
-    void TickTether(float DeltaTime);
+    void ApplyTetherStep(UCharacterMovementComponent& MoveComp);
+
+    // Summary: Starts hanging once the tether is taut and the character is airborne.
+    void FinishTetherStep(UCharacterMovementComponent& MoveComp);
 
     // Summary: Attempts to climb ledge near anchor.
     bool TryClimbToLedge();
@@ -290,9 +930,6 @@ private:
     // Summary: Checks whether climb input is allowed in current state.
     bool CanProcessClimbInput() const;
 
-    // Summary: Adjusts rope length from climb input with safety clamps.
-    void ApplyClimbLengthChange(float DeltaTime);
-
     // Summary: Returns sanitized minimum rope length that still allows climbing to the anchor.
     float GetClimbMinLength() const;
 
@@ -301,6 +938,91 @@ private:
 
     // Summary: Returns current world-space distance from the player to the anchor.
     float GetDistanceToAnchor() const;
+
+    // Summary: Rebuilds the rope particle chain on a straight line from anchor to character.
+    void InitializeRopeParticles();
+
+    // Summary: Copies serialized tuning into simulation core parameters.
+    FRopeSimParams MakeSimParams() const;
+
+    // Summary: Gathers actor and world data for one simulation core step.
+    FRopeSimInput MakeSimInput(float DeltaTime, const UCharacterMovementComponent& MoveComp) const;
+
+    // Summary: Sweeps interior rope particles against the world and pushes them out of contacts.
+    void ResolveRopeParticleCollisions();
+
+    // Summary: Pops unwrapped pivots and traces the free segment once for a new corner.
+    void UpdateRopeWrap();
+
+    // Summary: Pushes a pivot at a corner found on the free segment; returns whether the stack grew.
+    bool TryPushRopeWrapPivot(const FVector& SwingPivot, const FVector& EndLocation);
+
+    // Summary: Drops every wrap pivot so the rope runs straight to the anchor again.
+    void ResetRopeWrap();
+
+    // Summary: Recomputes wrapped length and rebuilds the particle chain on the new free segment.
+    void RebuildRopeAfterWrap();
+
+    // Summary: Returns rope length between the swing pivot and the character.
+    float GetFreeRopeLength() const;
+
+    // Summary: Counts still frames, sleeps, or wakes; returns whether the rope is asleep this frame.
+    bool UpdateRopeSleep();
+
+    // Summary: Returns whether swing, climb, or movement input is pending.
+    bool HasRopeInput(const UCharacterMovementComponent& MoveComp) const;
+
+    // Summary: Returns character speed relevant to sleep; radial speed into a taut rope is ignored while hanging.
+    float GetRopeSleepSpeed(const UCharacterMovementComponent& MoveComp) const;
+
+    // Summary: Freezes the rope and a hanging character in place.
+    void PutRopeToSleep(UCharacterMovementComponent& MoveComp);
+
+    // Summary: Pushes an input state with the current platform time when it differs from the latest one.
+    void PushRopeInputSample(const FVector2f& SwingInput, int8 ClimbSign);
+
+    // Summary: Returns whether recorded input drives the substeps of this rope.
+    bool UsesSubframeInput() const;
+
+    // Summary: Pops every sample up to now so input recorded outside substeps only updates the held value.
+    void DrainRopeInput();
+
+    // Summary: Ties the anchor to a movable component so it follows it; static components leave the anchor fixed in world space.
+    void BindAnchorComponent(UPrimitiveComponent* Component, FName BoneName, const FVector& Location, const FVector& Normal);
+
+    // Summary: Returns the world anchor location and normal on the bound component; false when the anchor is fixed.
+    bool SampleAnchorComponent(FVector& OutLocation, FVector& OutNormal) const;
+
+    // Summary: Pushes the accumulated rope pull into a simulating anchor, then follows the anchor component with one transform lookup.
+    void UpdateMovingAnchor();
+
+    // Summary: Adds the pull of the last step to the impulse pushed into a simulating anchor.
+    void AccumulateAnchorReaction(float StepSeconds);
+
+    // Summary: Swaps in a finished collision field, starts a build when the swing volume left the current one, and
+    // collects movable bodies near the rope with one overlap.
+    void UpdateRopeCollisionField();
+
+    // Summary: Pushes a particle out of static geometry using the collision field; returns false when it needs a scene sweep.
+    bool ResolveParticleWithField(const FRopeCollisionField& Field, const FVector& Location, const FVector& PreviousLocation, FVector& OutResolved) const;
+
+    // Summary: Hands the held rope to a loose rope actor lying along the current rope path; returns false when none could spawn.
+    bool DropLooseRope();
+
+    // Summary: Re-anchors on a nearby dropped rope and holds it when its nearest point is within grab distance.
+    bool TryPickUpLooseRope();
+
+    // Summary: Re-simulates the release arc from its first moved sample, collects sweep results, and issues sweeps within budget.
+    void UpdateReleasePreview();
+
+    // Summary: Drops the cached release arc; sweeps still in flight are ignored.
+    void ClearReleasePreview();
+
+    // Summary: Resamples the throw arc when the target or origin cell changes and sweeps a few segments per frame.
+    void UpdateAimArcValidation();
+
+    // Summary: Drops the throw arc validation state and any sweeps in flight.
+    void ClearAimArcValidation();
 #pragma endregion Helpers
 #pragma endregion Methods
 };
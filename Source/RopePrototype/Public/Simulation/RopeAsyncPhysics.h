@@ -0,0 +1,125 @@
+// Summary: Chaos async physics callback that advances rope constraints on the physics thread at the physics rate.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Simulation/RopeSimCore.h"
+
+// Summary: Game-thread snapshot of one rope pushed to the physics thread.
+struct FRopeAsyncRopeInput
+{
+    // Summary: Stable rope id assigned by the simulation subsystem.
+    int32 RopeId = INDEX_NONE;
+
+    // Summary: Reset counter; a new value rebuilds the physics-thread state from this input.
+    int32 Generation = 0;
+
+    // Summary: Constraint mode to advance.
+    ERopeSimStepKind Kind = ERopeSimStepKind::None;
+
+    // Summary: Rope tuning copied from the component.
+    FRopeSimParams Params;
+
+    // Summary: Actor and world data; DeltaTime is replaced by the physics step.
+    FRopeSimInput Input;
+
+    // Summary: Climb direction, 1 up and -1 down.
+    int32 ClimbInputSign = 0;
+
+    // Summary: Rope length used when the physics-thread state is rebuilt.
+    float RopeLength = 0.0f;
+};
+
+// Summary: Physics-thread result for one rope.
+struct FRopeAsyncRopeOutput
+{
+    // Summary: Stable rope id assigned by the simulation subsystem.
+    int32 RopeId = INDEX_NONE;
+
+    // Summary: Reset counter of the input this result was solved from.
+    int32 Generation = 0;
+
+    // Summary: Constraint mode that was advanced.
+    ERopeSimStepKind Kind = ERopeSimStepKind::None;
+
+    // Summary: Rope length after climb input.
+    float RopeLength = 0.0f;
+
+    // Summary: Climb direction after the core's extension clamps.
+    int32 ClimbInputSign = 0;
+
+    // Summary: Solved character location.
+    FVector Location = FVector::ZeroVector;
+
+    // Summary: Solved character velocity.
+    FVector Velocity = FVector::ZeroVector;
+
+    // Summary: Whether the rope ended the step taut.
+    bool bTensioned = false;
+
+    // Summary: Whether the tether pulled the character back inside rope length.
+    bool bBeyondLength = false;
+
+    // Summary: Rope pull on the character per unit mass in cm/s^2.
+    float Tension = 0.0f;
+
+    // Summary: Velocity change the rope applied to the character per unit mass in cm/s.
+    FVector ConstraintImpulse = FVector::ZeroVector;
+
+    // Summary: Anchor location the particle positions are relative to.
+    FVector Origin = FVector::ZeroVector;
+
+    // Summary: Solved anchor-relative particle chain for rendering.
+    TArray<FVector3f> Positions;
+
+    // Summary: Solved tension of every segment per unit particle mass.
+    TArray<float> SegmentTensions;
+};
+
+// Summary: Inputs marshalled from the game thread for one physics step.
+struct FRopeAsyncInput : public Chaos::FSimCallbackInput
+{
+    // Summary: Game frame counter that tells repeated physics steps from a new push.
+    uint32 Serial = 0;
+
+    // Summary: Every rope simulated on the physics thread this frame.
+    TArray<FRopeAsyncRopeInput> Ropes;
+
+    // Summary: Ropes whose physics-thread state should be released.
+    TArray<int32> RemovedRopeIds;
+
+    // Summary: Clears arrays when the marshalling pool recycles the input.
+    void Reset();
+};
+
+// Summary: Results marshalled back to the game thread after one physics step.
+struct FRopeAsyncOutput : public Chaos::FSimCallbackOutput
+{
+    // Summary: One result per rope advanced this step.
+    TArray<FRopeAsyncRopeOutput> Ropes;
+
+    // Summary: Clears arrays when the marshalling pool recycles the output.
+    void Reset();
+};
+
+// Summary: Advances rope cores on the physics thread; game thread only pushes input and reads results.
+class ROPEPROTOTYPE_API FRopeAsyncSimCallback : public Chaos::TSimCallbackObject<FRopeAsyncInput, FRopeAsyncOutput, Chaos::ESimCallbackOptions::Presimulate>
+{
+private:
+#pragma region Methods
+    // Summary: Steps every rope in the consumed input by the physics delta.
+    virtual void OnPreSimulate_Internal() override;
+#pragma endregion Methods
+
+#pragma region Variables And Properties
+    // Summary: Physics-thread rope state keyed by rope id.
+    TMap<int32, FRopeSimState> States;
+
+    // Summary: Reset counter last applied per rope id.
+    TMap<int32, int32> Generations;
+
+    // Summary: Serial of the last consumed input so repeated physics steps from one frame keep integrating from solved state.
+    uint32 LastConsumedSerial = 0;
+#pragma endregion Variables And Properties
+};
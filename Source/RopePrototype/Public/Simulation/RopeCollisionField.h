@@ -0,0 +1,127 @@
+// Summary: Sparse signed-distance cache of static geometry around a rope, built off the game thread and sampled in constant time.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+class UWorld;
+struct FCollisionQueryParams;
+
+// Summary: Shape of a static primitive copied into the field build.
+enum class ERopeFieldShape : uint8
+{
+    Sphere,
+    Box,
+    Capsule,
+    Convex
+};
+
+// Summary: Static collision element copied into world space on the game thread, so the build never touches engine objects.
+struct ROPEPROTOTYPE_API FRopeFieldPrimitive
+{
+    // Summary: Shape evaluated by GetSignedDistance.
+    ERopeFieldShape Shape = ERopeFieldShape::Sphere;
+
+    // Summary: World center of the sphere, box, or capsule.
+    FVector Center = FVector::ZeroVector;
+
+    // Summary: World rotation of the box or capsule; the capsule runs along local Z.
+    FQuat Rotation = FQuat::Identity;
+
+    // Summary: Box half extents; Z holds the capsule half segment length.
+    FVector Extent = FVector::ZeroVector;
+
+    // Summary: Sphere or capsule radius in cm.
+    float Radius = 0.0f;
+
+    // Summary: Outward world planes of a convex hull.
+    TArray<FPlane> Planes;
+
+    // Summary: World bounds used to find the bricks the primitive can reach.
+    FBox Bounds = FBox(ForceInit);
+
+    // Summary: Returns the signed distance in cm from a world location to the surface; negative inside. Convex distances
+    // are exact inside and a lower bound outside near edges, which only makes contacts start slightly early there.
+    float GetSignedDistance(const FVector& Location) const;
+};
+
+// Summary: Narrow-band distance field over a box around the rope anchor. Only bricks of 8^3 cells near static geometry are
+// stored; a dense brick table keeps every lookup O(1) without hashing. Bricks hold one extra sample layer so trilinear
+// interpolation and its gradient never read across brick boundaries.
+class ROPEPROTOTYPE_API FRopeCollisionField
+{
+public:
+#pragma region Methods
+    // Summary: Builds an empty field.
+    FRopeCollisionField();
+
+    // Summary: Copies blocking static collision inside a region; movable bodies are skipped and shapes without simple
+    // collision, such as complex-as-simple meshes, are returned as boxes that must keep using scene queries.
+    static void GatherStaticPrimitives(const UWorld& World, const FBox& GatherRegion, ECollisionChannel Channel, const FCollisionQueryParams& Params, TArray<FRopeFieldPrimitive>& OutPrimitives, TArray<FBox>& OutFallbackBoxes);
+
+    // Summary: Returns whether a region at the given cell size fits the brick table; larger regions never build.
+    static bool FitsBrickTable(const FBox& InRegion, float InVoxelSize);
+
+    // Summary: Samples the primitives into bricks covering the region; safe to run on a worker thread. Returns false and
+    // leaves the field empty when the region does not fit the brick table.
+    bool Build(const FBox& InRegion, float InVoxelSize, float InBandWidth, TConstArrayView<FRopeFieldPrimitive> Primitives, TArray<FBox>&& InFallbackBoxes);
+
+    // Summary: Drops every brick.
+    void Reset();
+
+    // Summary: Returns whether the field holds a built region.
+    bool IsBuilt() const;
+
+    // Summary: Returns the region the field was built for.
+    const FBox& GetRegion() const;
+
+    // Summary: Returns whether a sphere at the location can be resolved by the field alone: inside the region and clear of
+    // every fallback box.
+    bool CanResolve(const FVector& Location, float Radius) const;
+
+    // Summary: Returns the distance to static geometry and the outward normal at a location inside the region. Locations
+    // farther than the band report the band width and a zero normal.
+    float Sample(const FVector& Location, FVector& OutNormal) const;
+
+    // Summary: Returns the band width in cm; distances are only exact below it.
+    float GetBandWidth() const;
+
+    // Summary: Returns the number of stored bricks.
+    int32 NumBricks() const;
+
+    // Summary: Returns the memory held by brick samples and the brick table in bytes.
+    SIZE_T GetAllocatedSize() const;
+#pragma endregion Methods
+
+private:
+#pragma region Methods
+    // Summary: Returns the linear brick table index of a brick coordinate.
+    int32 GetBrickTableIndex(const FIntVector& Brick) const;
+#pragma endregion Methods
+
+#pragma region Variables And Properties
+    // Summary: World box the field covers.
+    FBox Region;
+
+    // Summary: Minimum corner of brick (0,0,0).
+    FVector Origin;
+
+    // Summary: Cell edge length in cm.
+    float VoxelSize;
+
+    // Summary: Distance beyond which samples are clamped.
+    float BandWidth;
+
+    // Summary: Bricks along each axis.
+    FIntVector BrickCounts;
+
+    // Summary: Brick slot per table entry, or INDEX_NONE where no geometry is within the band.
+    TArray<int32> BrickTable;
+
+    // Summary: Quantized distances of every stored brick, SamplesPerBrick bytes each.
+    TArray<int8> BrickSamples;
+
+    // Summary: Regions that must keep using scene queries.
+    TArray<FBox> FallbackBoxes;
+#pragma endregion Variables And Properties
+};
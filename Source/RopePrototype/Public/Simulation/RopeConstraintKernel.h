@@ -0,0 +1,74 @@
+// Summary: Structure-of-arrays rope chain lanes and VectorRegister4Float kernels projecting four constraints per instruction.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Summary: SoA buffers for one particle parity; padding lanes stay zero and are masked out of every kernel.
+struct FRopeParityLanes
+{
+    // Summary: Current positions per axis.
+    TArray<float, TAlignedHeapAllocator<16>> X;
+    TArray<float, TAlignedHeapAllocator<16>> Y;
+    TArray<float, TAlignedHeapAllocator<16>> Z;
+
+    // Summary: Positions at the start of the step per axis.
+    TArray<float, TAlignedHeapAllocator<16>> PreviousX;
+    TArray<float, TAlignedHeapAllocator<16>> PreviousY;
+    TArray<float, TAlignedHeapAllocator<16>> PreviousZ;
+
+    // Summary: Inverse particle masses; zero pins a lane.
+    TArray<float, TAlignedHeapAllocator<16>> InverseMasses;
+
+    // Summary: Particle index along the chain, used for long-range attachment distances.
+    TArray<float, TAlignedHeapAllocator<16>> ChainIndices;
+
+    // Summary: One for interior free particles that Verlet integration moves, zero otherwise.
+    TArray<float, TAlignedHeapAllocator<16>> IntegrateMask;
+
+    // Summary: One where the segment starting at this lane exists, zero for padding.
+    TArray<float, TAlignedHeapAllocator<16>> SegmentMask;
+
+    // Summary: XPBD multipliers of the segments starting at this lane.
+    TArray<float, TAlignedHeapAllocator<16>> Lambdas;
+
+    // Summary: Accumulated long-range tether multipliers of the particle in this lane.
+    TArray<float, TAlignedHeapAllocator<16>> TetherLambdas;
+};
+
+// Summary: Rope chain split into even and odd particles so each constraint colour reads contiguous lanes.
+// Even segments join Even[k] to Odd[k]; odd segments join Odd[k] to Even[k + 1].
+struct ROPEPROTOTYPE_API FRopeChainLanes
+{
+    // Summary: Copies an anchor-relative chain into the lanes and clears multipliers; a free end integrates like the interior.
+    void Gather(const TArray<FVector3f>& Positions, const TArray<FVector3f>& PreviousPositions, const TArray<float>& InverseMasses, bool bFreeEnd);
+
+    // Summary: Copies solved lanes and accumulated multipliers back into the chain.
+    void Scatter(TArray<FVector3f>& Positions, TArray<FVector3f>& PreviousPositions, TArray<float>& Lambdas, TArray<float>& TetherLambdas) const;
+
+    // Summary: Even particles at index 0, odd particles at index 1.
+    FRopeParityLanes Parity[2];
+
+    // Summary: Particles gathered from the chain.
+    int32 NumParticles = 0;
+
+    // Summary: Lanes processed per parity, a multiple of the lane width.
+    int32 NumLanes = 0;
+};
+
+namespace RopeConstraintKernel
+{
+    // Summary: Constraints projected per vector instruction.
+    constexpr int32 LaneWidth = 4;
+
+    // Summary: Returns whether the vector kernels run natively rather than through the scalar vector emulation.
+    ROPEPROTOTYPE_API bool IsVectorized();
+
+    // Summary: Verlet-integrates free lanes with damping and gravity.
+    ROPEPROTOTYPE_API void Integrate(FRopeChainLanes& Lanes, const FVector3f& GravityStep, float VelocityKeep);
+
+    // Summary: Projects one red-black XPBD pass, all even segments then all odd segments.
+    ROPEPROTOTYPE_API void ProjectDistanceConstraints(FRopeChainLanes& Lanes, float SegmentRestLength, float AlphaTilde);
+
+    // Summary: Pulls every free lane back inside its rope distance from the anchor at the origin and accumulates the tether multipliers.
+    ROPEPROTOTYPE_API void ProjectLongRangeAttachments(FRopeChainLanes& Lanes, float SegmentRestLength);
+}
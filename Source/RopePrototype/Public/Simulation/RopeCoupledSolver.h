@@ -0,0 +1,172 @@
+// Summary: Coupled XPBD solve for several bodies sharing ropes and several ropes sharing bodies, split into independent islands.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Summary: One body moved by the coupled solver, typically a hanging character.
+struct FRopeCoupledBody
+{
+    // Summary: World location in cm.
+    FVector Location = FVector::ZeroVector;
+
+    // Summary: Velocity in cm/s.
+    FVector Velocity = FVector::ZeroVector;
+
+    // Summary: Acceleration added on top of gravity for the next step, such as swing input, in cm/s^2.
+    FVector ExternalAcceleration = FVector::ZeroVector;
+
+    // Summary: Inverse mass in 1/kg; zero makes the body kinematic so ropes pull on it without moving it.
+    float InverseMass = 0.01f;
+};
+
+// Summary: Body tied to a rope and the rope length between it and the previous attachment or the anchor.
+struct FRopeCoupledAttachment
+{
+    // Summary: Index returned by AddBody.
+    int32 Body = INDEX_NONE;
+
+    // Summary: Rope length in cm from the previous attachment, or from the anchor for the first one.
+    float SpanLength = 0.0f;
+};
+
+// Summary: Solves every rope span of one world together: N bodies on M ropes. Bodies connected through shared ropes form an
+// island solved by one Gauss-Seidel loop, so two characters on one rope or one character on two ropes converge on a single
+// answer instead of correcting each other in turn. Unrelated islands step in parallel.
+class ROPEPROTOTYPE_API FRopeCoupledSolver
+{
+public:
+#pragma region Methods
+    // Summary: Builds an empty solver.
+    FRopeCoupledSolver();
+
+    // Summary: Removes every body and rope.
+    void Reset();
+
+    // Summary: Adds a body and returns its index.
+    int32 AddBody(const FRopeCoupledBody& Body);
+
+    // Summary: Adds a rope hanging from a fixed anchor through the given bodies, ordered from the anchor; returns its index.
+    int32 AddRope(const FVector& AnchorLocation, TConstArrayView<FRopeCoupledAttachment> Attachments, float Compliance = 0.0f);
+
+    // Summary: Enables or disables a rope; disabled ropes neither pull nor join islands.
+    void SetRopeActive(int32 Rope, bool bActive);
+
+    // Summary: Moves the fixed anchor of a rope.
+    void SetRopeAnchor(int32 Rope, const FVector& AnchorLocation);
+
+    // Summary: Changes the rope length above one attachment, for example while climbing.
+    void SetSpanLength(int32 Rope, int32 Attachment, float SpanLength);
+
+    // Summary: Number of bodies.
+    int32 NumBodies() const;
+
+    // Summary: Number of ropes, active or not.
+    int32 NumRopes() const;
+
+    // Summary: Read-only body state.
+    const FRopeCoupledBody& GetBody(int32 Body) const;
+
+    // Summary: Mutable body state, for writing input or teleporting between steps.
+    FRopeCoupledBody& GetMutableBody(int32 Body);
+
+    // Summary: Integrates every body and solves all active spans island by island.
+    void Step(float DeltaTime, const FVector& Gravity, int32 Iterations, float Damping);
+
+    // Summary: Returns the tension in newtons carried by the span above one attachment after the last step.
+    float GetSpanTension(int32 Rope, int32 Attachment) const;
+
+    // Summary: Returns how far the most stretched active span exceeds its length in cm after the last step.
+    float GetMaxViolation() const;
+
+    // Summary: Returns the number of islands built for the current topology.
+    int32 GetNumIslands() const;
+#pragma endregion Methods
+
+private:
+    // Summary: One unilateral distance constraint between two attachments of a rope.
+    struct FSpan
+    {
+        // Summary: Upper body, or INDEX_NONE when the span hangs from the rope anchor.
+        int32 BodyA = INDEX_NONE;
+
+        // Summary: Lower body.
+        int32 BodyB = INDEX_NONE;
+
+        // Summary: Rope owning the span.
+        int32 Rope = INDEX_NONE;
+
+        // Summary: Rope length of the span in cm.
+        float Length = 0.0f;
+
+        // Summary: Accumulated XPBD multiplier for the current step; never positive because a rope only pulls.
+        float Lambda = 0.0f;
+    };
+
+    // Summary: Anchor and span range of one rope.
+    struct FRope
+    {
+        // Summary: Fixed world anchor.
+        FVector AnchorLocation = FVector::ZeroVector;
+
+        // Summary: First span in the flat span array.
+        int32 FirstSpan = 0;
+
+        // Summary: Number of spans, one per attachment.
+        int32 NumSpans = 0;
+
+        // Summary: XPBD compliance shared by every span, cm of stretch per kg cm/s^2 of pull.
+        float Compliance = 0.0f;
+
+        // Summary: Whether the rope takes part in the solve.
+        bool bActive = true;
+    };
+
+#pragma region Methods
+    // Summary: Groups bodies linked through active spans with union-find and lays island bodies and spans out contiguously.
+    void BuildIslands();
+
+    // Summary: Returns the union-find root of a body with path halving.
+    int32 FindRoot(int32 Body);
+
+    // Summary: Integrates, solves, and updates velocities of one island.
+    void StepIsland(int32 Island, float DeltaTime, const FVector& Gravity, int32 Iterations, float Damping);
+#pragma endregion Methods
+
+#pragma region Variables And Properties
+    // Summary: Bodies in insertion order.
+    TArray<FRopeCoupledBody> Bodies;
+
+    // Summary: Body locations at the start of the current step.
+    TArray<FVector> PreviousLocations;
+
+    // Summary: Ropes in insertion order.
+    TArray<FRope> Ropes;
+
+    // Summary: Spans of every rope, contiguous per rope.
+    TArray<FSpan> Spans;
+
+    // Summary: Union-find parent per body, only valid while islands are built.
+    TArray<int32> IslandParents;
+
+    // Summary: Body indices grouped by island.
+    TArray<int32> IslandBodies;
+
+    // Summary: Span indices grouped by island.
+    TArray<int32> IslandSpans;
+
+    // Summary: Start of each island in IslandBodies, plus one end entry.
+    TArray<int32> IslandBodyOffsets;
+
+    // Summary: Start of each island in IslandSpans, plus one end entry.
+    TArray<int32> IslandSpanOffsets;
+
+    // Summary: Largest span stretch of the last step in cm.
+    float MaxViolation;
+
+    // Summary: Step duration of the last solve, used to turn multipliers into forces.
+    float LastStepTime;
+
+    // Summary: Whether bodies or ropes changed since islands were built.
+    bool bIslandsDirty;
+#pragma endregion Variables And Properties
+};
@@ -0,0 +1,83 @@
+// Summary: Lock-free ring of timestamped swing and climb input samples consumed by rope substeps in time windows.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include <atomic>
+
+// Summary: Full rope input state at the moment an input callback changed it.
+struct FRopeInputSample
+{
+    // Summary: Platform time in seconds when the callback fired.
+    double Time = 0.0;
+
+    // Summary: Swing input axis, X right and Y forward.
+    FVector2f SwingInput = FVector2f::ZeroVector;
+
+    // Summary: Climb direction, 1 up and -1 down.
+    int8 ClimbSign = 0;
+};
+
+// Summary: Input applied by one substep.
+struct FRopeInputWindow
+{
+    // Summary: Swing input averaged over the window, or the strongest tap that started and ended inside it.
+    FVector2D SwingInput = FVector2D::ZeroVector;
+
+    // Summary: Climb direction held at the end of the window.
+    int32 ClimbSign = 0;
+
+    // Summary: Climb direction pressed and released again inside the window; zero when no tap happened.
+    int32 ClimbTapSign = 0;
+};
+
+// Summary: Single-producer single-consumer ring; input callbacks push, rope substeps pop in order without locks.
+// Each frame maps the simulated seconds it owes onto the platform time elapsed since the previous frame, so substeps
+// see input in the order and at roughly the moment it arrived rather than one value per frame.
+class ROPEPROTOTYPE_API FRopeInputBuffer
+{
+public:
+    // Summary: Samples held before the producer starts dropping; one frame pushes a handful at most.
+    static constexpr uint32 Capacity = 64;
+
+#pragma region Methods
+    // Summary: Builds an empty ring holding neutral input.
+    FRopeInputBuffer();
+
+    // Summary: Producer side; appends a sample and returns false when the ring is full.
+    bool Push(const FRopeInputSample& Sample);
+
+    // Summary: Consumer side; maps the next simulated seconds onto platform time up to the frame end.
+    void BeginFrame(double FrameEndTime, float SimulatedSeconds);
+
+    // Summary: Consumer side; integrates the samples inside the next window of simulated seconds.
+    FRopeInputWindow Consume(float SimulatedSeconds);
+
+    // Summary: Consumer side; integrates every sample up to a platform time as one window.
+    FRopeInputWindow ConsumeUntil(double WindowEnd);
+
+    // Summary: Consumer side; drops queued samples and holds the given input from now on.
+    void Reset(const FRopeInputSample& HeldSample);
+#pragma endregion Methods
+
+private:
+#pragma region Variables And Properties
+    // Summary: Sample storage indexed by the wrapped head and tail counters.
+    TStaticArray<FRopeInputSample, Capacity> Samples;
+
+    // Summary: Count of samples ever pushed; written by the producer only.
+    std::atomic<uint32> Head;
+
+    // Summary: Count of samples ever popped; written by the consumer only.
+    std::atomic<uint32> Tail;
+
+    // Summary: Consumer-only input in effect since the last popped sample.
+    FRopeInputSample Held;
+
+    // Summary: Consumer-only platform time the next window starts at.
+    double Cursor;
+
+    // Summary: Consumer-only platform seconds per simulated second for the current frame.
+    double TimeScale;
+#pragma endregion Variables And Properties
+};
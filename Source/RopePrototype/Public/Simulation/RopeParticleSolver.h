@@ -0,0 +1,163 @@
+// Summary: Structure-of-arrays XPBD particle chain used to simulate the rope between its anchor and the character.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/RopeConstraintKernel.h"
+
+// Summary: Rope particle chain solved with XPBD distance constraints; particle 0 is the fixed anchor and the last particle is the character.
+// Positions are stored relative to the anchor so single precision stays exact far from the world origin.
+template <typename T>
+class TRopeParticleSolver
+{
+public:
+    // Summary: Anchor-relative vector type used by the solver math.
+    using FLocalVector = UE::Math::TVector<T>;
+
+#pragma region Methods
+    // Summary: Builds an empty solver with inextensible segments.
+    TRopeParticleSolver();
+
+    // Summary: Lays particles out on a straight line from anchor to end and clears solver history.
+    void Initialize(const FVector& AnchorLocation, const FVector& EndLocation, int32 ParticleCount, float TotalRestLength, float EndInverseMass);
+
+    // Summary: Releases all particle buffers.
+    void Reset();
+
+    // Summary: Returns whether the particle buffers hold a valid chain.
+    bool IsInitialized() const;
+
+    // Summary: Returns number of particles including anchor and character end.
+    int32 Num() const;
+
+    // Summary: Distributes the total rope rest length evenly across all segments.
+    void SetTotalRestLength(float TotalRestLength);
+
+    // Summary: Moves the fixed anchor particle by rebasing the local frame; world positions of free particles are unchanged.
+    void SetAnchorLocation(const FVector& AnchorLocation);
+
+    // Summary: Writes the character position into the last particle before a step; previous position keeps the last solved location.
+    void SetEndLocation(const FVector& EndLocation);
+
+    // Summary: Replaces particle positions with an external solve of the same chain; current positions become history.
+    void SetLocalPositions(const FVector& InOrigin, const TArray<FLocalVector>& NewPositions);
+
+    // Summary: Sets XPBD segment compliance; zero keeps segments inextensible, positive values stretch them and drop the long-range tethers.
+    void SetCompliance(float InCompliance);
+
+    // Summary: Chooses the SoA vector kernel or the scalar path for single-precision steps; double precision always runs scalar.
+    void SetUseVectorKernel(bool bInUseVectorKernel);
+
+    // Summary: Returns whether single-precision steps run the SoA vector kernel.
+    bool IsUsingVectorKernel() const;
+
+    // Summary: Lets the last particle integrate under gravity like the interior instead of following a character; used by dropped ropes.
+    void SetFreeEnd(bool bInFreeEnd);
+
+    // Summary: Integrates free particles under gravity and projects distance and tether constraints.
+    void Step(float DeltaTime, const FVector& Gravity, int32 Iterations, float Damping);
+
+    // Summary: Returns solved character end location in world space.
+    FVector GetEndLocation() const;
+
+    // Summary: Returns whether the character end is held at full rope length.
+    bool IsEndTensioned() const;
+
+    // Summary: Returns rest length of a single segment.
+    float GetSegmentRestLength() const;
+
+    // Summary: Returns number of segments between neighbouring particles.
+    int32 GetSegmentCount() const;
+
+    // Summary: Returns the tension of one segment after the last step, per unit particle mass in cm/s^2; segment 0 hangs from the anchor.
+    float GetSegmentTension(int32 Segment) const;
+
+    // Summary: Read-only tension of every segment after the last step, per unit particle mass in cm/s^2.
+    const TArray<float>& GetSegmentTensions() const;
+
+    // Summary: Replaces segment tensions with those of an external solve of the same chain.
+    void SetSegmentTensions(const TArray<float>& NewTensions);
+
+    // Summary: World location of the local frame, equal to the anchor.
+    const FVector& GetOrigin() const;
+
+    // Summary: Converts one particle to world space.
+    FVector GetWorldPosition(int32 Index) const;
+
+    // Summary: Writes world-space particle positions ordered from anchor to character.
+    void GetWorldPositions(TArray<FVector>& OutPositions) const;
+
+    // Summary: Read-only anchor-relative particle positions ordered from anchor to character.
+    const TArray<FLocalVector>& GetLocalPositions() const;
+
+    // Summary: Read-only anchor-relative particle positions from the previous step.
+    const TArray<FLocalVector>& GetLocalPreviousPositions() const;
+
+    // Summary: Mutable anchor-relative positions used by collision passes between solver steps.
+    TArray<FLocalVector>& GetMutableLocalPositions();
+#pragma endregion Methods
+
+private:
+#pragma region Methods
+    // Summary: Runs integration and all iterations through the SoA vector kernel; returns false when it cannot be used.
+    bool StepVectorKernel(const FLocalVector& GravityStep, T VelocityKeep, T AlphaTilde, int32 IterationCount, bool bLongRangeAttachments);
+
+    // Summary: Projects one red-black XPBD pass over the segment distance constraints, matching the vector kernel order.
+    void SolveDistanceConstraints(T AlphaTilde);
+
+    // Summary: Projects unilateral long-range tethers so no particle drifts beyond its rope distance from the anchor.
+    void SolveLongRangeAttachments();
+
+    // Summary: Converts the accumulated segment and tether multipliers of the last step into segment tensions.
+    void UpdateSegmentTensions(T StepTime);
+#pragma endregion Methods
+
+#pragma region Variables And Properties
+    // Summary: World location of the local frame; always the anchor.
+    FVector Origin;
+
+    // Summary: Current particle positions relative to the origin.
+    TArray<FLocalVector> Positions;
+
+    // Summary: Particle positions relative to the origin at the start of the last step.
+    TArray<FLocalVector> PreviousPositions;
+
+    // Summary: Inverse particle masses; zero pins a particle.
+    TArray<T> InverseMasses;
+
+    // Summary: Accumulated XPBD multipliers per segment for the current step.
+    TArray<T> Lambdas;
+
+    // Summary: Accumulated long-range tether multipliers per particle for the current step.
+    TArray<T> TetherLambdas;
+
+    // Summary: Tension per unit particle mass of every segment after the last step, in cm/s^2.
+    TArray<float> SegmentTensions;
+
+    // Summary: Rest length of every segment.
+    T SegmentRestLength;
+
+    // Summary: XPBD compliance of segments; zero keeps the rope inextensible.
+    T Compliance;
+
+    // Summary: Whether the end tether was active after the last step.
+    bool bEndTensioned;
+
+    // Summary: Whether single-precision steps run the SoA vector kernel.
+    bool bUseVectorKernel;
+
+    // Summary: Whether the last particle integrates freely instead of being written by SetEndLocation.
+    bool bFreeEnd;
+
+    // Summary: SoA scratch lanes reused by the vector kernel between steps.
+    FRopeChainLanes Lanes;
+#pragma endregion Variables And Properties
+};
+
+extern template class ROPEPROTOTYPE_API TRopeParticleSolver<float>;
+extern template class ROPEPROTOTYPE_API TRopeParticleSolver<double>;
+
+// Summary: Single-precision rope chain used at runtime.
+using FRopeParticleSolver = TRopeParticleSolver<float>;
+
+// Summary: Double-precision rope chain kept as the benchmark and precision reference.
+using FRopeParticleSolverDouble = TRopeParticleSolver<double>;
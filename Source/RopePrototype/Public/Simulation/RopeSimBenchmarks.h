@@ -0,0 +1,95 @@
+// Summary: Headless timing harness for the rope simulation, run from the console or the RopeSimBenchmark commandlet.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Summary: Timing result of one benchmark scenario.
+struct FRopeBenchmarkResult
+{
+    // Summary: Scenario label printed in reports.
+    FString Name;
+
+    // Summary: Number of simulation steps timed.
+    int32 Steps = 0;
+
+    // Summary: Average wall time per step in nanoseconds.
+    double NanosecondsPerStep = 0.0;
+
+    // Summary: Steps that fit into one second at the measured cost.
+    double StepsPerSecond = 0.0;
+
+    // Summary: Largest deviation from the double-precision reference, or stretch past rope length, in cm; zero when the scenario measures neither.
+    double MaxErrorCm = 0.0;
+
+    // Summary: Speedup over the scalar reference of the same scenario; zero when not compared.
+    double Speedup = 0.0;
+
+    // Summary: Largest swing energy deviation relative to the initial energy; zero when the scenario does not measure it.
+    double EnergyDrift = 0.0;
+
+    // Summary: Shortest rope length reached in cm; zero when the scenario does not track it.
+    double MinRopeLength = 0.0;
+
+    // Summary: Longest rope length reached in cm; zero when the scenario does not track it.
+    double MaxRopeLength = 0.0;
+};
+
+namespace RopeSimBenchmarks
+{
+    // Summary: Steps per scenario when run from the console, the commandlet without -steps=, or automation.
+    constexpr int32 DefaultSteps = 20000;
+
+    // Summary: Largest accepted deviation of the vector kernel from the scalar path in cm.
+    constexpr double KernelToleranceCm = 0.01;
+
+    // Summary: Largest accepted stretch of the rigid rope past its length in cm; long-range attachments clamp it exactly.
+    constexpr double CoreStretchToleranceCm = 1.0;
+
+    // Summary: Shortest rope the climb scenario may climb to in cm.
+    constexpr float ClimbBenchmarkMinLength = 100.0f;
+
+    // Summary: Times the XPBD particle chain swinging with the given particle count.
+    ROPEPROTOTYPE_API FRopeBenchmarkResult RunParticleSolver(int32 ParticleCount, int32 Steps);
+
+    // Summary: Times the single- and double-precision chains far from the world origin and records the single-precision drift.
+    ROPEPROTOTYPE_API void RunParticleSolverPrecision(int32 ParticleCount, int32 Steps, TArray<FRopeBenchmarkResult>& OutResults);
+
+    // Summary: Times the scalar and SoA vector constraint paths, records their deviation, and warns when it exceeds tolerance.
+    ROPEPROTOTYPE_API void RunParticleSolverKernels(int32 ParticleCount, int32 Steps, TArray<FRopeBenchmarkResult>& OutResults);
+
+    // Summary: Times the simulation core swinging freely under gravity and swing input, recording the worst stretch past rope length.
+    ROPEPROTOTYPE_API FRopeBenchmarkResult RunSwing(int32 Steps);
+
+    // Summary: Times rigid and elastic hanging on a self-integrated character and warns if the elastic rope diverges at the benchmark step.
+    ROPEPROTOTYPE_API void RunStretchModes(int32 Steps, TArray<FRopeBenchmarkResult>& OutResults);
+
+    // Summary: Swings an undamped pendulum for a fixed simulated time with every integrator and step rate, reporting energy drift against cost.
+    ROPEPROTOTYPE_API void RunSwingIntegrators(TArray<FRopeBenchmarkResult>& OutResults);
+
+    // Summary: Times independent single-constraint hanging steps against the coupled solver on the same ropes, one island per rope.
+    ROPEPROTOTYPE_API void RunCoupledSolver(int32 RopeCount, int32 Steps, TArray<FRopeBenchmarkResult>& OutResults);
+
+    // Summary: Times the coupled solver with two characters on one rope and one character on two ropes, recording the worst stretch.
+    ROPEPROTOTYPE_API void RunCoupledScenarios(int32 Steps, TArray<FRopeBenchmarkResult>& OutResults);
+
+    // Summary: Builds a collision field over a static scene, then times per-particle field samples against evaluating every
+    // primitive directly and records the worst in-band distance error.
+    ROPEPROTOTYPE_API void RunCollisionField(int32 ParticleCount, int32 Steps, TArray<FRopeBenchmarkResult>& OutResults);
+
+    // Summary: Sweeps the same particles through a private game world holding the field scene as static bodies, the path the
+    // field replaces, and times field samples of the same chain against it. Needs an engine, so only the commandlet runs it.
+    ROPEPROTOTYPE_API void RunCollisionSceneQueries(int32 ParticleCount, int32 Steps, TArray<FRopeBenchmarkResult>& OutResults);
+
+    // Summary: Times the simulation core tether constraint while walking away from the anchor, recording the worst stretch past rope length.
+    ROPEPROTOTYPE_API FRopeBenchmarkResult RunTether(int32 Steps);
+
+    // Summary: Times the simulation core while climbing up and down long enough to reach both length clamps, recording the
+    // shortest and longest rope and the worst stretch.
+    ROPEPROTOTYPE_API FRopeBenchmarkResult RunClimb(int32 Steps);
+
+    // Summary: Runs every registered scenario with the given step count and appends the results.
+    ROPEPROTOTYPE_API void RunAll(int32 Steps, TArray<FRopeBenchmarkResult>& OutResults);
+
+    // Summary: Prints results to the rope log category.
+    ROPEPROTOTYPE_API void LogResults(const TArray<FRopeBenchmarkResult>& Results);
+}
@@ -0,0 +1,214 @@
+// Summary: UObject-free rope simulation core shared by the rope component, batch ticking, and headless benchmarks.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/RopeParticleSolver.h"
+
+// Summary: Constraint mode advanced by one simulation step.
+enum class ERopeSimStepKind : uint8
+{
+    None,
+    Hanging,
+    Tether
+};
+
+// Summary: Time integrator for a hanging character that the core moves itself.
+enum class ERopeSimIntegrator : uint8
+{
+    // Summary: Explicit velocity update followed by projection onto the rope; cheapest, but energy drifts with the step size.
+    Explicit,
+
+    // Summary: Constrained velocity Verlet (RATTLE); symplectic, so swing energy stays bounded at large steps.
+    Rattle,
+
+    // Summary: Classical fourth-order Runge-Kutta on the constrained pendulum; very accurate per step, four evaluations.
+    RK4
+};
+
+// Summary: Tuning values copied from the rope component before each step.
+struct FRopeSimParams
+{
+    // Summary: Longest allowed rope in cm.
+    float MaxRopeLength = 1200.0f;
+
+    // Summary: Shortest rope reachable by climbing in cm.
+    float ClimbMinLength = 0.0f;
+
+    // Summary: Tangential swing acceleration in cm/s^2.
+    float SwingAcceleration = 600.0f;
+
+    // Summary: Fraction of swing velocity removed per second.
+    float SwingDamping = 0.05f;
+
+    // Summary: Climb speed along the rope in cm/s.
+    float ClimbSpeed = 200.0f;
+
+    // Summary: Particles in the rope chain including anchor and character.
+    int32 ParticleCount = 16;
+
+    // Summary: Constraint iterations per step.
+    int32 SolverIterations = 8;
+
+    // Summary: Character inverse mass relative to one rope particle.
+    float CharacterInverseMass = 0.05f;
+
+    // Summary: Whether the hanging rope stretches like a bungee instead of holding its length.
+    bool bElastic = false;
+
+    // Summary: Elastic spring stiffness per unit character mass in 1/s^2, the pull in cm/s^2 per cm of stretch.
+    float ElasticStiffness = 60.0f;
+
+    // Summary: Elastic damping of stretch speed per unit character mass in 1/s.
+    float ElasticDamping = 2.0f;
+
+    // Summary: Integrator for rigid hanging when the core moves the character; falling movement keeps its own integration.
+    ERopeSimIntegrator SwingIntegrator = ERopeSimIntegrator::Explicit;
+};
+
+// Summary: Per-step inputs gathered from the owning actor and world.
+struct FRopeSimInput
+{
+    // Summary: Fixed step duration in seconds.
+    float DeltaTime = 0.0f;
+
+    // Summary: Point the free rope swings from in world space; the anchor, or the last wrap pivot when the rope bends around geometry.
+    FVector AnchorLocation = FVector::ZeroVector;
+
+    // Summary: Rope length laid along wrap pivots between the true anchor and AnchorLocation.
+    float WrappedLength = 0.0f;
+
+    // Summary: Character location before the step.
+    FVector ActorLocation = FVector::ZeroVector;
+
+    // Summary: Character velocity before the step.
+    FVector ActorVelocity = FVector::ZeroVector;
+
+    // Summary: Character forward axis used to orient swing input.
+    FVector ActorForward = FVector::ForwardVector;
+
+    // Summary: Character right axis used to orient swing input.
+    FVector ActorRight = FVector::RightVector;
+
+    // Summary: Gravity acceleration already scaled by the movement gravity scale.
+    FVector Gravity = FVector::ZeroVector;
+
+    // Summary: Swing input axis, X right and Y forward.
+    FVector2D SwingInput = FVector2D::ZeroVector;
+
+    // Summary: Climb direction tapped and released before this step; climbs for the step without latching the climb input.
+    int32 ClimbTapSign = 0;
+
+    // Summary: Whether the hanging step moves the character by its velocity; false when a falling movement update already moved it this frame.
+    bool bIntegrateActor = false;
+};
+
+// Summary: Persistent rope simulation state advanced in place by the core.
+struct FRopeSimState
+{
+    // Summary: Total rest length of the rope in cm.
+    float RopeLength = 1200.0f;
+
+    // Summary: Climb direction input, 1 for up, -1 for down.
+    int32 ClimbInputSign = 0;
+
+    // Summary: Constrained character location produced by the last step.
+    FVector Location = FVector::ZeroVector;
+
+    // Summary: Character velocity produced by the last step.
+    FVector Velocity = FVector::ZeroVector;
+
+    // Summary: Whether the rope ended the last step taut.
+    bool bTensioned = false;
+
+    // Summary: Whether the tether step had to pull the character back inside rope length.
+    bool bBeyondLength = false;
+
+    // Summary: Rope pull on the character along the rope in the last step, per unit character mass in cm/s^2.
+    float Tension = 0.0f;
+
+    // Summary: Velocity change the rope constraint applied to the character in the last step, per unit character mass in cm/s.
+    FVector ConstraintImpulse = FVector::ZeroVector;
+
+    // Summary: Particle chain between anchor and character.
+    FRopeParticleSolver Particles;
+};
+
+// Summary: Pure rope math; never touches actors, movement components, or the world.
+class ROPEPROTOTYPE_API FRopeSimCore
+{
+public:
+#pragma region Methods
+    // Summary: Dispatches one step of the given kind; safe to call from worker threads.
+    static void Step(ERopeSimStepKind Kind, const FRopeSimParams& Params, const FRopeSimInput& Input, FRopeSimState& State);
+
+    // Summary: Advances swing, climb, and the particle chain while hanging.
+    static void StepHanging(const FRopeSimParams& Params, const FRopeSimInput& Input, FRopeSimState& State);
+
+    // Summary: Advances the ground tether constraint while holding the rope on foot.
+    static void StepTether(const FRopeSimParams& Params, const FRopeSimInput& Input, FRopeSimState& State);
+
+    // Summary: Adjusts rope length from climb input with safety clamps.
+    static void ApplyClimbLengthChange(const FRopeSimParams& Params, float DeltaTime, FRopeSimState& State);
+
+    // Summary: Returns rope length left between the swing pivot and the character.
+    static float GetFreeLength(const FRopeSimInput& Input, const FRopeSimState& State);
+
+    // Summary: Returns the unit axis the rope bends around at a wrap pivot, or zero when the rope runs straight.
+    static FVector ComputeWrapBendAxis(const FVector& PreviousPoint, const FVector& Pivot, const FVector& EndLocation);
+
+    // Summary: Returns whether the bend at a wrap pivot turned against its push-time axis, meaning the rope unwrapped.
+    static bool IsWrapReversed(const FVector& PreviousPoint, const FVector& Pivot, const FVector& BendAxis, const FVector& EndLocation);
+
+    // Summary: Converts a world location into the single-precision frame centered on the rope anchor.
+    static FVector3f MakeAnchorRelative(const FVector& AnchorLocation, const FVector& WorldLocation);
+
+    // Summary: Removes velocity along the rope so hanging starts without a radial jolt.
+    static FVector RemoveRadialVelocity(const FVector& AnchorLocation, const FVector& ActorLocation, const FVector& Velocity);
+
+    // Summary: Returns normalized throw progress.
+    static float GetFlightAlpha(float Elapsed, float Duration);
+
+    // Summary: Returns the rope tip location along the throw arc.
+    static FVector EvaluateFlightArc(const FVector& Start, const FVector& Target, float Alpha);
+
+    // Summary: Returns the velocity a jump release launches the character with; it replaces the swing velocity.
+    static FVector GetReleaseLaunchVelocity(const FVector& SwingVelocity, const FVector& ActorForward);
+
+    // Summary: Returns the position on a ballistic arc after the given seconds.
+    static FVector EvaluateBallisticArc(const FVector& Start, const FVector& Velocity, const FVector& Gravity, float Time);
+
+    // Summary: Returns the downward ledge probe sweep that starts just off the anchor along its normal.
+    static void GetLedgeProbe(const FVector& AnchorLocation, const FVector& AnchorNormal, float ProbeRadius, FVector& OutStart, FVector& OutEnd);
+
+    // Summary: Returns whether a probe hit counts as a ledge: facing the anchor normal or walkable.
+    static bool IsValidLedgeNormal(const FVector& ImpactNormal, const FVector& AnchorNormal, float NormalDotThreshold);
+
+    // Summary: Returns the ledge stand location on the probe hit, pushed onto the ledge against the planar anchor normal.
+    // The caller adds the capsule height.
+    static FVector GetLedgeStandLocation(const FVector& ImpactPoint, const FVector& AnchorNormal, const FVector& FallbackForward, float StandOffDistance);
+#pragma endregion Methods
+
+private:
+#pragma region Methods
+    // Summary: Projects rigid hanging: the particle chain holds the character at rope length.
+    static void StepRigidHanging(const FRopeSimParams& Params, const FRopeSimInput& Input, const FVector3f& RopeDir, FVector3f& Velocity, FRopeSimState& State);
+
+    // Summary: Integrates rigid hanging of a self-integrated character with RATTLE or RK4, then lets the chain follow.
+    static void StepConstrainedSwing(const FRopeSimParams& Params, const FRopeSimInput& Input, const FVector3f& ExternalAccel, FVector3f& Velocity, FRopeSimState& State);
+
+    // Summary: Advances an anchor-relative offset and velocity one RATTLE step on a rope of the given length.
+    static void IntegrateRattle(const FVector3f& ExternalAccel, float Length, float DeltaTime, FVector3f& Offset, FVector3f& Velocity);
+
+    // Summary: Advances an anchor-relative offset and velocity one RK4 step on a rope of the given length.
+    static void IntegrateRK4(const FVector3f& ExternalAccel, float Length, float DeltaTime, FVector3f& Offset, FVector3f& Velocity);
+
+    // Summary: Acceleration on the rope sphere: external tangential part plus centripetal pull while the rope carries tension.
+    static FVector3f ComputeConstrainedAcceleration(const FVector3f& ExternalAccel, const FVector3f& Offset, const FVector3f& Velocity, bool bTaut);
+
+    // Summary: Integrates elastic hanging: an implicit radial spring lets the rope stretch and pull back.
+    static void StepElasticHanging(const FRopeSimParams& Params, const FRopeSimInput& Input, const FVector3f& RopeDir, float Distance, FVector3f& Velocity, FRopeSimState& State);
+
+    // Summary: Feeds the character end into the particle chain with the given segment compliance and steps it.
+    static void StepParticles(const FRopeSimParams& Params, const FRopeSimInput& Input, const FVector& EndLocation, float Compliance, FRopeSimState& State);
+#pragma endregion Methods
+};
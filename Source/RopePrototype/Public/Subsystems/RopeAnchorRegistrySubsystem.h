@@ -0,0 +1,155 @@
+// Summary: World subsystem that keeps grapple anchors in a uniform hash grid and ranks them against an aim cone.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RopeAnchorRegistrySubsystem.generated.h"
+
+class UBPC_RopeAnchorPointComponent;
+
+// Summary: Anchor span and attach data handed to the registry; Start equals End for a point anchor.
+struct FRopeAnchorDesc
+{
+    // Summary: First end of the span in world space.
+    FVector Start = FVector::ZeroVector;
+
+    // Summary: Second end of the span in world space.
+    FVector End = FVector::ZeroVector;
+
+    // Summary: World normal the rope attaches with.
+    FVector Normal = FVector::UpVector;
+
+    // Summary: Radius in cm around the span that counts as on target.
+    float Radius = 0.0f;
+
+    // Summary: Actor owning the anchor; a line-of-sight hit on it confirms the anchor. Null for baked anchors.
+    TWeakObjectPtr<AActor> Owner;
+
+    // Summary: Whether a baked ledge stand location belongs to the span.
+    bool bHasLedge = false;
+
+    // Summary: Offset from a point on the span to the ledge stand location, before capsule height.
+    FVector LedgeOffset = FVector::ZeroVector;
+};
+
+// Summary: Best anchor found by a cone query.
+struct FRopeAnchorCandidate
+{
+    // Summary: Point on the anchor span closest to the aim axis.
+    FVector Location = FVector::ZeroVector;
+
+    // Summary: World normal of the anchor.
+    FVector Normal = FVector::UpVector;
+
+    // Summary: Radius of the anchor, used as the confirm trace tolerance.
+    float Radius = 0.0f;
+
+    // Summary: Actor owning the anchor, if any.
+    TWeakObjectPtr<AActor> Owner;
+
+    // Summary: Ranking score; lower is better.
+    float Score = 0.0f;
+};
+
+UCLASS()
+class URopeAnchorRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+#pragma region Methods
+#pragma region Lifecycle
+    // Summary: Drops every entry and grid cell when the world tears down.
+    virtual void Deinitialize() override;
+#pragma endregion Lifecycle
+
+#pragma region Registration
+    // Summary: Adds an anchor component and returns its handle.
+    int32 RegisterAnchor(const UBPC_RopeAnchorPointComponent& Anchor);
+
+    // Summary: Adds an anchor span without a component, such as baked ledge data, and returns its handle.
+    int32 RegisterAnchor(const FRopeAnchorDesc& Desc);
+
+    // Summary: Re-reads a component anchor after it moved and rebuckets it when its cells changed.
+    void UpdateAnchor(int32 Handle);
+
+    // Summary: Replaces the span of an anchor and rebuckets it when its cells changed.
+    void UpdateAnchor(int32 Handle, const FRopeAnchorDesc& Desc);
+
+    // Summary: Removes an anchor; the handle may be reused afterwards.
+    void UnregisterAnchor(int32 Handle);
+
+    // Summary: Number of registered anchors.
+    int32 GetNumAnchors() const;
+#pragma endregion Registration
+
+#pragma region Query
+    // Summary: Finds the best anchor inside a cone from Origin along Direction. Each anchor's radius widens the cone
+    // around it; candidates rank by angular offset over HalfAngleDegrees plus DistanceWeight times distance over
+    // MaxDistance. Visits only the grid cells the cone passes through.
+    bool FindBestAnchorInCone(const FVector& Origin, const FVector& Direction, float MaxDistance, float HalfAngleDegrees, float DistanceWeight, FRopeAnchorCandidate& OutCandidate);
+
+    // Summary: Finds the baked ledge closest to a rope anchor within MaxDistance whose normal agrees with the anchor
+    // normal, and returns its stand location. Lets ledge climbs skip the probe sweep where baked data is streamed in.
+    bool FindBakedLedge(const FVector& AnchorLocation, const FVector& AnchorNormal, float MaxDistance, float NormalDotThreshold, FVector& OutStandLocation) const;
+#pragma endregion Query
+#pragma endregion Methods
+
+private:
+    // Summary: Registered anchor with its cached grid footprint.
+    struct FAnchorEntry
+    {
+        // Summary: Span, normal, radius, and owner of the anchor.
+        FRopeAnchorDesc Desc;
+
+        // Summary: Component feeding the span, or null for anchors registered by descriptor.
+        TWeakObjectPtr<const UBPC_RopeAnchorPointComponent> Component;
+
+        // Summary: Lowest grid cell the inflated span touches.
+        FIntVector MinCell = FIntVector::ZeroValue;
+
+        // Summary: Highest grid cell the inflated span touches.
+        FIntVector MaxCell = FIntVector::ZeroValue;
+
+        // Summary: Query that last scored this entry, so anchors spanning several cells are scored once.
+        uint32 QueryStamp = 0;
+    };
+
+    // Summary: Grid cell listing the anchors that touch it.
+    struct FAnchorCell
+    {
+        // Summary: Handles of the anchors in the cell.
+        TArray<int32> Entries;
+
+        // Summary: Query that last visited this cell.
+        uint32 QueryStamp = 0;
+    };
+
+#pragma region Methods
+    // Summary: Reads the descriptor of an anchor component.
+    static FRopeAnchorDesc MakeAnchorDesc(const UBPC_RopeAnchorPointComponent& Anchor);
+
+    // Summary: Computes the cell range covered by a span inflated by its radius.
+    static void GetCellRange(const FRopeAnchorDesc& Desc, FIntVector& OutMin, FIntVector& OutMax);
+
+    // Summary: Computes the cell range covered by a world box.
+    static void GetCellRange(const FBox& Bounds, FIntVector& OutMin, FIntVector& OutMax);
+
+    // Summary: Adds or removes an entry handle from every cell in its range.
+    void LinkEntry(int32 Handle, bool bLink);
+
+    // Summary: Stores a new descriptor for an entry and relinks it only when its cell range changed.
+    void SetEntryDesc(int32 Handle, const FRopeAnchorDesc& Desc);
+#pragma endregion Methods
+
+#pragma region Variables And Properties
+    // Summary: Registered anchors; sparse so handles stay stable across removals.
+    TSparseArray<FAnchorEntry> Entries;
+
+    // Summary: Occupied grid cells keyed by integer cell coordinate.
+    TMap<FIntVector, FAnchorCell> Cells;
+
+    // Summary: Counter stamped on entries and cells during a query.
+    uint32 QueryCounter = 0;
+#pragma endregion Variables And Properties
+};
@@ -0,0 +1,148 @@
+// Summary: World subsystem that owns packed rope simulation state and batch-ticks every registered rope component.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Simulation/RopeSimCore.h"
+#include "RopeSimulationSubsystem.generated.h"
+
+class UBPC_RopeTraversalComponent;
+class ABPA_LooseRope;
+class FRopeAsyncSimCallback;
+
+UCLASS()
+class URopeSimulationSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+#pragma region Methods
+#pragma region Lifecycle
+    // Summary: Releases all packed slots and the physics-thread callback when the world tears down.
+    virtual void Deinitialize() override;
+
+    // Summary: Runs per-frame rope logic, then all fixed rope steps as parallel core batches.
+    virtual void Tick(float DeltaTime) override;
+
+    // Summary: Stat id used by the tickable object manager.
+    virtual TStatId GetStatId() const override;
+#pragma endregion Lifecycle
+
+#pragma region Registration
+    // Summary: Adds a rope component and returns its packed slot.
+    int32 RegisterRope(UBPC_RopeTraversalComponent& Rope);
+
+    // Summary: Removes a rope component by swapping the last slot into its place.
+    void UnregisterRope(int32 Slot);
+
+    // Summary: Marks whether a rope needs per-frame processing.
+    void SetRopeActive(int32 Slot, bool bActive);
+
+    // Summary: Returns whether the slot refers to a registered rope.
+    bool IsValidSlot(int32 Slot) const;
+
+    // Summary: Mutable packed simulation state of a registered rope.
+    FRopeSimState& GetState(int32 Slot);
+
+    // Summary: Read-only packed simulation state of a registered rope.
+    const FRopeSimState& GetState(int32 Slot) const;
+
+    // Summary: Number of registered ropes.
+    int32 GetNumRopes() const;
+
+    // Summary: Number of ropes currently flagged active.
+    int32 GetNumActiveRopes() const;
+
+    // Summary: Adds a dropped rope to the settling list or removes it once it sleeps.
+    void SetLooseRopeAwake(ABPA_LooseRope& LooseRope, bool bAwake);
+#pragma endregion Registration
+#pragma endregion Methods
+
+private:
+#pragma region Methods
+    // Summary: Periodically buckets active ropes by distance to the nearest local view and on-screen visibility.
+    void UpdateRopeSignificance(float DeltaTime);
+
+    // Summary: Settles every awake dropped rope and drops the ones that fell asleep from the list.
+    void TickLooseRopes(float DeltaTime);
+
+    // Summary: Runs one batched fixed step for every rope that still owes a step this frame.
+    void RunBatchedStep(int32 StepIndex);
+
+    // Summary: Compacts slots of ropes that unregistered during the tick.
+    void FlushDeferredRemovals();
+
+    // Summary: Applies the newest physics-thread results and pushes this frame's inputs for physics-thread ropes.
+    void TickAsyncRopes();
+
+    // Summary: Registers the rope callback with the world's Chaos solver on first use.
+    bool EnsureAsyncCallback();
+
+    // Summary: Unregisters the rope callback from the Chaos solver.
+    void ReleaseAsyncCallback();
+#pragma endregion Methods
+
+#pragma region Variables And Properties
+    // Summary: Registered rope components, index-aligned with every packed array below.
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UBPC_RopeTraversalComponent>> Ropes;
+
+    // Summary: Packed persistent simulation state per rope.
+    TArray<FRopeSimState> States;
+
+    // Summary: Packed core parameters gathered for the current step.
+    TArray<FRopeSimParams> StepParams;
+
+    // Summary: Packed core inputs gathered for the current step.
+    TArray<FRopeSimInput> StepInputs;
+
+    // Summary: Packed constraint kind gathered for the current step.
+    TArray<ERopeSimStepKind> StepKinds;
+
+    // Summary: Fixed steps each rope still owes this frame.
+    TArray<int32> PendingSteps;
+
+    // Summary: Whether each rope needs per-frame processing.
+    TArray<bool> ActiveFlags;
+
+    // Summary: Stable id per rope used to match physics-thread results after slots are compacted.
+    TArray<int32> RopeIds;
+
+    // Summary: Next stable rope id to hand out.
+    int32 NextRopeId = 0;
+
+    // Summary: Slots participating in the current batched step.
+    TArray<int32> BatchSlots;
+
+    // Summary: Slots released while ticking, compacted once the tick completes.
+    TArray<int32> DeferredRemovals;
+
+    // Summary: Cached count of active ropes to early out idle frames.
+    int32 NumActiveRopes = 0;
+
+    // Summary: Whether the batched tick is iterating the packed arrays.
+    bool bIsTicking = false;
+
+    // Summary: Time since the last significance pass.
+    float SignificanceAccumulator = 0.0f;
+
+    // Summary: Local view locations gathered for the current significance pass.
+    TArray<FVector> SignificanceViews;
+
+    // Summary: Dropped ropes still settling; sleeping ones are not listed and cost nothing.
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<ABPA_LooseRope>> AwakeLooseRopes;
+
+    // Summary: Whether the loose-rope pass is iterating the awake list.
+    bool bIsTickingLooseRopes = false;
+
+    // Summary: Chaos callback advancing physics-thread ropes; owned by the solver once registered.
+    FRopeAsyncSimCallback* AsyncCallback = nullptr;
+
+    // Summary: Frame counter stamped on each async input push.
+    uint32 AsyncSerial = 0;
+
+    // Summary: Rope ids whose physics-thread state should be released with the next push.
+    TArray<int32> PendingAsyncRemovals;
+#pragma endregion Variables And Properties
+};
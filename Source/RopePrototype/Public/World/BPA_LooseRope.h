@@ -0,0 +1,181 @@
+// Summary: Dropped rope lying in the world; settles with a cheap particle sim, then sleeps until a character or object disturbs it.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Simulation/RopeParticleSolver.h"
+#include "BPA_LooseRope.generated.h"
+
+class USphereComponent;
+class USplineMeshComponent;
+class UStaticMesh;
+class UMaterialInterface;
+class UPrimitiveComponent;
+
+UCLASS()
+class ABPA_LooseRope : public AActor
+{
+    GENERATED_BODY()
+
+public:
+#pragma region Methods
+#pragma region Lifecycle
+    // Summary: Builds the anchor root and disturbance sphere; the actor never ticks itself.
+    ABPA_LooseRope();
+
+    // Summary: Binds disturbance overlaps.
+    virtual void BeginPlay() override;
+
+    // Summary: Leaves the awake list of the simulation subsystem.
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+#pragma endregion Lifecycle
+
+#pragma region Simulation
+    // Summary: Lays the chain along the dropped rope path, ordered from the anchor, and starts settling it.
+    void InitializeFromDrop(const FVector& InAnchorNormal, const TArray<FVector>& RopePath, float InRopeLength);
+
+    // Summary: Advances settling in fixed steps; returns whether the rope is still awake. Called by the simulation subsystem only.
+    bool TickLooseRope(float DeltaTime);
+
+    // Summary: Resumes settling; call after pushing the rope or moving what it lies on.
+    void WakeLooseRope();
+
+    // Summary: Returns whether the rope sleeps and costs nothing per frame.
+    bool IsLooseRopeAsleep() const;
+#pragma endregion Simulation
+
+#pragma region Query
+    // Summary: Returns the fixed end of the rope.
+    FVector GetAnchorLocation() const;
+
+    // Summary: Returns the surface normal at the anchor.
+    FVector GetAnchorNormal() const;
+
+    // Summary: Returns the distance from a location to the nearest point of the rope.
+    float GetDistanceToRope(const FVector& Location) const;
+
+    // Summary: Returns the rope rest length in cm.
+    float GetRopeLength() const;
+#pragma endregion Query
+#pragma endregion Methods
+
+private:
+#pragma region Methods
+#pragma region Overlap
+    // Summary: Wakes the rope for anything entering its bounds and offers it to characters for pickup.
+    UFUNCTION()
+    void HandleDisturbBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+    // Summary: Withdraws the pickup offer from a character leaving the rope bounds.
+    UFUNCTION()
+    void HandleDisturbEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+#pragma endregion Overlap
+
+#pragma region Simulation
+    // Summary: Sweeps free particles against the world, pushes them out of contacts, and applies ground friction.
+    void ResolveParticleCollisions();
+
+    // Summary: Stops simulating, fits the disturbance sphere to the settled rope, and leaves the awake list.
+    void PutLooseRopeToSleep();
+
+    // Summary: Centers the disturbance sphere on the chain and grows it by the grab radius.
+    void FitDisturbSphere();
+
+    // Summary: Places one pooled spline mesh per segment along the chain.
+    void UpdateRopeVisual();
+#pragma endregion Simulation
+#pragma endregion Methods
+
+#pragma region Members
+#pragma region Components
+    // Summary: Root placed at the rope anchor.
+    UPROPERTY(VisibleAnywhere, Category="Loose Rope", meta=(AllowPrivateAccess="true"))
+    USceneComponent* AnchorRoot;
+
+    // Summary: Query-only sphere around the rope; overlaps wake it and offer it for pickup.
+    UPROPERTY(VisibleAnywhere, Category="Loose Rope", meta=(AllowPrivateAccess="true"))
+    USphereComponent* DisturbSphere;
+
+    // Summary: Spline mesh per rope segment.
+    UPROPERTY(Transient)
+    TArray<USplineMeshComponent*> RopeMeshPool;
+#pragma endregion Components
+
+#pragma region Config
+    // Summary: Static mesh used for rope segments.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Visual", meta=(Tooltip="Static mesh stretched along each rope segment", AllowPrivateAccess="true"))
+    UStaticMesh* RopeMesh;
+
+    // Summary: Material override for rope segments.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Visual", meta=(Tooltip="Material override applied to rope segments", AllowPrivateAccess="true"))
+    UMaterialInterface* RopeMeshMaterial;
+
+    // Summary: Rope mesh thickness scale.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Visual", meta=(Tooltip="Radius scale applied to rope mesh thickness", ClampMin="0.01", AllowPrivateAccess="true"))
+    float RopeRadius;
+
+    // Summary: Particles including anchor and free end.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Simulation", meta=(Tooltip="Particles in the dropped chain including anchor and free end", ClampMin="2", ClampMax="64", AllowPrivateAccess="true"))
+    int32 ParticleCount;
+
+    // Summary: Constraint iterations per step.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Simulation", meta=(Tooltip="XPBD iterations per settling step", ClampMin="1", ClampMax="32", AllowPrivateAccess="true"))
+    int32 SolverIterations;
+
+    // Summary: Settling steps per second.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Simulation", meta=(Tooltip="Fixed settling rate in Hz; a lying rope needs far less than a swinging one", ClampMin="15.0", ClampMax="240.0", AllowPrivateAccess="true"))
+    float StepRate;
+
+    // Summary: Velocity removed per second while settling.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Simulation", meta=(Tooltip="Fraction of particle velocity removed per second", ClampMin="0.0", AllowPrivateAccess="true"))
+    float Damping;
+
+    // Summary: Tangential velocity kept by particles touching the ground per step.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Simulation", meta=(Tooltip="0 sticks touching particles in place, 1 lets them slide freely", ClampMin="0.0", ClampMax="1.0", AllowPrivateAccess="true"))
+    float GroundFriction;
+
+    // Summary: Particle collision radius.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Simulation", meta=(Tooltip="Sweep radius of rope particles in centimeters", ClampMin="0.0", AllowPrivateAccess="true"))
+    float CollisionRadius;
+
+    // Summary: Particle speed below which the rope counts as settled.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Sleep", meta=(Tooltip="Fastest particle speed in cm/s that still counts as at rest", ClampMin="0.0", AllowPrivateAccess="true"))
+    float SleepSpeedThreshold;
+
+    // Summary: Consecutive settled steps before sleeping.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Sleep", meta=(Tooltip="Consecutive at-rest steps before the rope sleeps", ClampMin="1", AllowPrivateAccess="true"))
+    int32 SleepStepsRequired;
+
+    // Summary: Longest a wake may last before the rope is forced to sleep.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Sleep", meta=(Tooltip="Seconds after waking before the rope sleeps even if it still jitters", ClampMin="0.5", AllowPrivateAccess="true"))
+    float MaxAwakeSeconds;
+
+    // Summary: Margin around the rope within which characters wake it and may pick it up.
+    UPROPERTY(EditDefaultsOnly, Category="Loose Rope|Sleep", meta=(Tooltip="Distance in centimeters around the settled rope that wakes it and offers pickup", ClampMin="0.0", AllowPrivateAccess="true"))
+    float GrabRadius;
+#pragma endregion Config
+
+#pragma region State
+    // Summary: Dropped chain; particle 0 is the anchor and the last particle is the free end.
+    FRopeParticleSolver Particles;
+
+    // Summary: Surface normal at the anchor, handed back to a character picking the rope up.
+    FVector AnchorNormal;
+
+    // Summary: Rope rest length in cm.
+    float RopeLength;
+
+    // Summary: Unsimulated time carried to the next frame.
+    float StepAccumulator;
+
+    // Summary: Consecutive settled steps.
+    int32 QuietSteps;
+
+    // Summary: Seconds since the rope last woke.
+    float AwakeSeconds;
+
+    // Summary: Whether the rope sleeps.
+    bool bLooseRopeAsleep;
+#pragma endregion State
+#pragma endregion Members
+};
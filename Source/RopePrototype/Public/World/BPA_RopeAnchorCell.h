@@ -0,0 +1,47 @@
+// Summary: Spatially loaded actor placed by the anchor bake; streams in with its World Partition cell and feeds the cell's
+// baked anchors and ledges to the anchor registry.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "BPA_RopeAnchorCell.generated.h"
+
+class URopeAnchorCellData;
+
+UCLASS(NotBlueprintable)
+class ABPA_RopeAnchorCell : public AActor
+{
+    GENERATED_BODY()
+
+public:
+#pragma region Methods
+#pragma region Lifecycle
+    // Summary: Builds a tickless actor with a bare root at the cell center.
+    ABPA_RopeAnchorCell();
+
+    // Summary: Registers the baked anchors.
+    virtual void BeginPlay() override;
+
+    // Summary: Unregisters the baked anchors when the cell streams out.
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+#pragma endregion Lifecycle
+
+#pragma region Bake
+    // Summary: Replaces the baked data; used by the bake commandlet only.
+    void SetCellData(URopeAnchorCellData* InCellData);
+
+    // Summary: Returns the baked data.
+    URopeAnchorCellData* GetCellData() const;
+#pragma endregion Bake
+#pragma endregion Methods
+
+private:
+#pragma region Variables And Properties
+    // Summary: Baked anchors of the cell; a hard reference so it loads with the actor.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake", meta=(AllowPrivateAccess="true"))
+    TObjectPtr<URopeAnchorCellData> CellData;
+
+    // Summary: Registry handles of the anchors registered at BeginPlay.
+    TArray<int32> AnchorHandles;
+#pragma endregion Variables And Properties
+};
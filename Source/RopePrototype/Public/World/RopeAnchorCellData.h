@@ -0,0 +1,60 @@
+// Summary: Baked grapple anchors and ledge stand locations for one World Partition cell, written by the anchor bake commandlet.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "RopeAnchorCellData.generated.h"
+
+// Summary: Run of ledge edge baked as one anchor span.
+USTRUCT()
+struct FRopeBakedAnchor
+{
+    GENERATED_BODY()
+
+    // Summary: First end of the edge span in world space.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    FVector3f Start = FVector3f::ZeroVector;
+
+    // Summary: Second end of the edge span in world space.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    FVector3f End = FVector3f::ZeroVector;
+
+    // Summary: Outward face normal the rope attaches with.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    FVector3f Normal = FVector3f::UpVector;
+
+    // Summary: Offset from a point on the span to the ledge stand location, before capsule height.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    FVector3f LedgeOffset = FVector3f::ZeroVector;
+
+    // Summary: Whether the ledge probe accepted the edge, so LedgeOffset is valid.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    bool bHasLedge = false;
+};
+
+UCLASS()
+class URopeAnchorCellData : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    // Summary: World bounds of the cell the data was baked for.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    FBox CellBounds = FBox(ForceInit);
+
+    // Summary: Aim assist radius given to every baked anchor in cm.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    float AnchorRadius = 0.0f;
+
+    // Summary: Ledge stand-off distance the ledges were baked with.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    float LedgeStandOffDistance = 0.0f;
+
+    // Summary: Ledge normal threshold the ledges were baked with.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    float LedgeNormalDotThreshold = 0.0f;
+
+    // Summary: Baked anchor spans inside the cell.
+    UPROPERTY(VisibleAnywhere, Category="Rope|Bake")
+    TArray<FRopeBakedAnchor> Anchors;
+};
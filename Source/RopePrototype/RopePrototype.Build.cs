@@ -24,7 +24,15 @@ public class RopePrototype : ModuleRules
         {
             "Slate",
             "SlateCore",
-            "EnhancedInput"
+            "EnhancedInput",
+            "Chaos",
+            "PhysicsCore"
         });
+
+        // The anchor bake commandlet loads and saves editor worlds; game builds never link UnrealEd.
+        if (Target.bBuildEditor)
+        {
+            PrivateDependencyModuleNames.Add("UnrealEd");
+        }
     }
 }
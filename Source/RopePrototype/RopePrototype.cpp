@@ -2,4 +2,6 @@
 #include "RopePrototype.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogRopePrototype);
+
 IMPLEMENT_PRIMARY_GAME_MODULE(FDefaultGameModuleImpl, RopePrototype, "RopePrototype");
@@ -2,3 +2,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// Summary: Log category shared by rope simulation, tooling, and benchmarks.
+DECLARE_LOG_CATEGORY_EXTERN(LogRopePrototype, Log, All);
+
+// Summary: Stat group exposing rope simulation cost via "stat Rope".
+DECLARE_STATS_GROUP(TEXT("Rope"), STATGROUP_Rope, STATCAT_Advanced);